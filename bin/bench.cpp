@@ -0,0 +1,738 @@
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+#include <iostream>
+#include <memory>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <random>
+#include "fishing_logic.hpp"
+#include "level_config.hpp"
+#include "game_constants.hpp"
+#include "bot.hpp"
+#include "lane_scheduler.hpp"
+#include "alloc_tracker.hpp"
+#include "job_system.hpp"
+#include "fish_school.hpp"
+#include "fishing_line.hpp"
+#include "particle_system.hpp"
+#include "water_surface.hpp"
+#include "render_commands.hpp"
+#include "resolution_scaler.hpp"
+#include "fishing_view.hpp"
+
+// Headless load generator: a bot plays fishing rounds as fast as possible and tick times are reported
+namespace
+{
+    struct BenchConfig
+    {
+        int rounds = 20;
+        int day = 10;
+        int rodLevel = 4;
+        int roundDuration = Game::ROUND_DURATION;
+        unsigned int seed = 1;
+        int lanes = 1;      // Rounds played side by side each tick through LaneScheduler
+        int threads = 0;    // Lane workers, 0 uses every core
+        std::string botName = "greedy";
+        std::string levelTablePath = Resource::LEVEL_TABLE;
+        bool checkAllocs = false; // Fail if ticks or recorded frames allocate after the first round
+        int floaters = 0;   // Floater scaling run instead of rounds when > 0
+        int pool = 0;       // Shared job system workers, 0 = one per core besides the caller
+        bool school = false; // Schooling run at growing school sizes instead of rounds
+        bool line = false;   // Fishing line timing run instead of rounds
+        int particles = 0;   // Particle timing run with this many live particles instead of rounds when > 0
+        bool water = false;  // Water surface timing run instead of rounds
+        bool renderScale = false; // Resolution scaler run against a simulated GPU instead of rounds
+    };
+
+    // Zones that must not allocate once a round is running; drawView only runs when frames are recorded
+    const char* const STEADY_STATE_ZONES[] = {"FishingLogic::update", "FishingLogic::handleCatch", "FishingView::drawView"};
+
+    const Uint32 BENCH_FRAME_MS = 16; // Simulated time per tick, matches the 60 FPS frame cap
+    const int SCALING_TICKS = 600;    // Ticks per floater scaling run, several spawn waves
+    const int MAX_SCALING_FLOATERS = 120000; // Fish and hazard pools hold at most 65535 slots each
+    const int SCHOOL_SIZES[] = {250, 500, 1000, 2000, 4000, 8000, 16000};
+    const int SCHOOL_TICKS = 300;
+    const double FRAME_BUDGET_MS = 1000.0 / 60.0;
+    const int LINE_TICKS = 60000;
+    const double LINE_BUDGET_MICROS = 100.0;
+    const int PARTICLE_FRAMES = 600;
+    const int PARTICLE_WARMUP_FRAMES = 60;
+    const int WATER_FRAMES = 6000;
+    const int WATER_SPLASH_INTERVAL = 20;   // Frames between random splashes
+    const double WATER_BUDGET_MICROS = 250.0;
+
+    /**
+     * @struct RenderLoadPhase
+     * @brief Simulated render cost for a stretch of frames: a fixed part plus a part that follows the pixel count
+     */
+    struct RenderLoadPhase
+    {
+        const char* name;
+        int frames;
+        double fixedMs;
+        double fullScaleFillMs;
+    };
+    // A weak GPU at the largest window: heavy pond, calm pond, then a burst of particles
+    const RenderLoadPhase RENDER_LOAD_PHASES[] = {
+        {"heavy", 300, 1.5, 12.0},
+        {"light", 600, 1.5, 4.0},
+        {"burst", 300, 2.0, 20.0}
+    };
+    const int MAX_RENDER_SETTLE_FRAMES = 10;   // Frames from a load jump to frames within budget
+    const double RENDER_NOISE = 0.05;           // Frame-to-frame jitter, +-5%
+
+    void printUsage(const char* program)
+    {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --rounds N     Rounds to play (default 20)\n"
+                  << "  --day N        Level table day to load (default 10)\n"
+                  << "  --rod N        Rod level (default 4, catches every fish size)\n"
+                  << "  --duration MS  Simulated round length (default " << Game::ROUND_DURATION << ")\n"
+                  << "  --seed N       Base seed (default 1)\n"
+                  << "  --bot NAME     Bot to play with (default greedy)\n"
+                  << "  --lanes N      Rounds ticked in parallel per frame (default 1)\n"
+                  << "  --threads N    Lane workers with --lanes, 0 = all cores (default 0)\n"
+                  << "  --levels PATH  Level table\n"
+                  << "  --check-allocs Report heap allocations and fail if ticks allocate after round 1; with one lane,\n"
+                  << "                 also records every frame headlessly and fails if recording allocates\n"
+                  << "  --floaters N   Time one round of N floaters at 1..all threads instead, and check results match\n"
+                  << "  --school       Time schooling steering and movement at growing school sizes instead\n"
+                  << "  --line         Time the fishing line simulation while reeling a bare hook, a fish and a heavy hazard\n"
+                  << "  --particles N  Time stepping and recording N live particles per frame instead\n"
+                  << "  --water        Time the waterline ripples (step, rasterize, upload recording) at the largest resolution instead\n"
+                  << "  --render-scale Run the dynamic resolution scaler against simulated GPU loads instead\n"
+                  << "  --pool N       Job system worker threads, 0 = one per core besides the main thread (default 0)" << std::endl;
+    }
+
+    /**
+     * @struct HeadlessDisplay
+     * @brief Hidden window and software renderer on SDL's dummy video driver, so views can load and record without a display
+     */
+    struct HeadlessDisplay
+    {
+        SDL_Window* window = nullptr;
+        SDL_Renderer* renderer = nullptr;
+
+        /**
+         * @brief Starts SDL video, SDL_image and SDL_ttf and creates the window and renderer
+         * @param screen Window size
+         * @return bool false if any of them failed
+         */
+        bool open(const WorldMetrics& screen)
+        {
+            SDL_setenv("SDL_VIDEODRIVER", "dummy", 1); // Read by SDL_Init; the hint of the same name is newer
+            if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+                std::cerr << "Headless display: SDL could not initialize: " << SDL_GetError() << std::endl;
+                return false;
+            }
+            if (!(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG) || TTF_Init() < 0) {
+                std::cerr << "Headless display: SDL_image or SDL_ttf could not initialize: " << SDL_GetError() << std::endl;
+                return false;
+            }
+            window = SDL_CreateWindow("bench", 0, 0, static_cast<int>(screen.screenW), static_cast<int>(screen.screenH),
+                                      SDL_WINDOW_HIDDEN);
+            if (window) {
+                renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+            }
+            if (!renderer) {
+                std::cerr << "Headless display: no window or renderer: " << SDL_GetError() << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        ~HeadlessDisplay()
+        {
+            if (renderer) {
+                SDL_DestroyRenderer(renderer);
+            }
+            if (window) {
+                SDL_DestroyWindow(window);
+            }
+            TTF_Quit();
+            IMG_Quit();
+            SDL_Quit();
+        }
+    };
+
+    double percentileMicros(std::vector<double>& sorted, int percent)
+    {
+        size_t rank = (sorted.size() * percent + 99) / 100;
+        return sorted[rank == 0 ? 0 : rank - 1];
+    }
+
+    /**
+     * @brief FNV-1a hash of every floater's position and active flag, to compare runs exactly
+     */
+    uint64_t floaterStateHash(FishingLogic& logic)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](const void* data, size_t size) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; i++) {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        };
+        auto mixFloater = [&mix](const Floater& floater) {
+            float values[2] = {floater.getPosition().x, floater.getPosition().y};
+            unsigned char active = floater.isActive() ? 1 : 0;
+            mix(values, sizeof(values));
+            mix(&active, 1);
+        };
+        for (const auto& fish : logic.getAllFishRef()) {
+            mixFloater(*fish);
+        }
+        for (const auto& hazard : logic.getHazardsRef()) {
+            mixFloater(*hazard);
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Plays the same crowded round once per thread count and reports tick time against one thread
+     * @return int exit code, 1 if any run's floaters differ from the single-threaded run
+     */
+    int runFloaterScaling(const BenchConfig& config, const WorldMetrics& metrics)
+    {
+        int floaters = std::min(config.floaters, MAX_SCALING_FLOATERS);
+        LevelParams level;
+        level.smallFish = level.mediumFish = level.bigFish = floaters / 6;
+        level.normalHazards = level.heavyHazards = level.shockHazards = floaters / 6;
+
+        int maxThreads = JobSystem::shared().getWorkerCount() + 1;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Floater scaling: " << floaters << " floaters, " << SCALING_TICKS << " ticks, up to "
+                  << maxThreads << " thread(s)" << std::endl;
+
+        uint64_t expected = 0;
+        double singleMs = 0.0;
+        for (int threads = 1; threads <= maxThreads; threads++) {
+            FishingLogic logic(level, SCALING_TICKS * BENCH_FRAME_MS * 2, config.rodLevel, metrics, false, true);
+            logic.seedRandom(config.seed);
+            logic.setFloaterThreads(threads);
+            logic.setRunning(true);
+            logic.spawnNewFloaters();
+            logic.resetRoundStartTime();
+
+            auto start = std::chrono::steady_clock::now();
+            for (int tick = 0; tick < SCALING_TICKS; tick++) {
+                logic.update();
+                logic.advanceClock(BENCH_FRAME_MS);
+            }
+            double tickMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / SCALING_TICKS;
+
+            uint64_t state = floaterStateHash(logic);
+            if (threads == 1) {
+                expected = state;
+                singleMs = tickMs;
+            }
+            std::cout << "  " << threads << " thread(s): " << tickMs << " ms/tick  speedup x"
+                      << std::setprecision(2) << singleMs / tickMs << std::setprecision(3) << std::endl;
+            if (state != expected) {
+                std::cerr << "FAIL: floaters with " << threads << " threads differ from the single-threaded run" << std::endl;
+                return 1;
+            }
+        }
+        std::cout << "  Every thread count matched the single-threaded run" << std::endl;
+        return 0;
+    }
+
+    /**
+     * @brief Times FishSchool steering plus movement for ever larger schools of small fish
+     * @details Fish that swim off one side come back on the other, so the school size stays fixed
+     * @return int exit code
+     */
+    int runSchoolScaling(const BenchConfig& config, const WorldMetrics& metrics)
+    {
+        std::mt19937 rng(config.seed);
+        std::uniform_real_distribution<float> randomX(0.0f, metrics.screenW - metrics.fishW);
+        std::uniform_real_distribution<float> randomY(metrics.surfaceY, metrics.rodMaxY - metrics.fishH);
+        std::uniform_real_distribution<float> randomSpeed(Game::SCHOOL_MIN_SPEED, Game::MAX_FISH_SPEED);
+
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Schooling: " << SCHOOL_TICKS << " ticks per size, "
+                  << JobSystem::shared().getWorkerCount() + 1 << " thread(s)" << std::endl;
+        for (int size : SCHOOL_SIZES) {
+            FloaterPool<Fish> fish;
+            fish.reserve(size);
+            for (int i = 0; i < size; i++) {
+                std::unique_ptr<Fish> one(new Fish(metrics.fishW, metrics.fishH, 0.0f));
+                one->setPosition(randomX(rng), randomY(rng));
+                one->setDirection(i % 2 ? 1.0f : -1.0f, 1.0f);
+                one->setSpeed(randomSpeed(rng) * metrics.widthScale, 0.0f);
+                one->setActive(true);
+                fish.add(std::move(one));
+            }
+            FishSchool school;
+            school.reserve(fish.size(), metrics);
+
+            auto start = std::chrono::steady_clock::now();
+            for (int tick = 0; tick < SCHOOL_TICKS; tick++) {
+                school.steer(fish);
+                for (auto& one : fish) {
+                    one->update();
+                    Vector2D position = one->getPosition();
+                    if (position.x >= metrics.screenW) {
+                        one->setPosition(-metrics.fishW, position.y);
+                    } else if (position.x + metrics.fishW <= 0) {
+                        one->setPosition(metrics.screenW, position.y);
+                    }
+                }
+            }
+            double tickMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / SCHOOL_TICKS;
+            std::cout << "  " << std::setw(6) << size << " fish: " << tickMs << " ms/tick"
+                      << (tickMs <= FRAME_BUDGET_MS ? "" : "  (over the 60 FPS frame budget)") << std::endl;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Times FishingLine steps while the hook is cast and reeled with each kind of load
+     * @details Fails if a point leaves the pond area or a step takes over LINE_BUDGET_MICROS on average
+     * @return int exit code
+     */
+    int runLineTiming(const WorldMetrics& metrics)
+    {
+        struct LineLoad {
+            const char* name;
+            float load;
+            float sidePull;
+        };
+        const LineLoad loads[] = {
+            {"bare hook", 0.0f, 0.0f},
+            {"fish", Game::LINE_FISH_LOAD, 1.0f},
+            {"heavy hazard", 1.0f - Game::HEAVY_HAZARD_SLOW_FACTOR, 0.0f}
+        };
+
+        const float reelSpeed = metrics.rodSpeed;
+        const float travel = metrics.rodMaxY - metrics.rodMinY;
+        const int period = std::max(2, static_cast<int>(2 * travel / reelSpeed));
+        Vector2D points[FishingLine::POINTS];
+
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Fishing line: " << FishingLine::SEGMENTS << " segments, " << Game::LINE_ITERATIONS
+                  << " passes, " << LINE_TICKS << " ticks per load" << std::endl;
+        for (const LineLoad& load : loads) {
+            Vector2D tip(metrics.centerX, metrics.scaleH(Visuals::ROD_TOP_PERCENT));
+            FishingLine line;
+            line.reset(tip, Vector2D(metrics.centerX, metrics.rodMinY), metrics, reelSpeed);
+
+            double totalMicros = 0.0;
+            float lowest = 0.0f;
+            bool escaped = false;
+            for (int tick = 0; tick < LINE_TICKS; tick++) {
+                // Cast down then reel back up, over and over
+                int phase = tick % period;
+                float down = phase < period / 2 ? phase * reelSpeed : (period - phase) * reelSpeed;
+                Vector2D hook(metrics.centerX, metrics.rodMinY + std::min(down, travel));
+
+                auto start = std::chrono::steady_clock::now();
+                line.step(tip, hook, load.load, load.sidePull);
+                totalMicros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+                line.copyPoints(points);
+                for (const Vector2D& point : points) {
+                    lowest = std::max(lowest, point.y);
+                    escaped |= !(point.x >= 0.0f && point.x <= metrics.screenW && point.y >= 0.0f && point.y <= metrics.screenH);
+                }
+            }
+            double stepMicros = totalMicros / LINE_TICKS;
+            std::cout << "  " << std::left << std::setw(13) << load.name << std::right << stepMicros << " us/step"
+                      << "  lowest point " << lowest << std::endl;
+            if (escaped) {
+                std::cerr << "FAIL: the line left the screen with a " << load.name << std::endl;
+                return 1;
+            }
+            if (stepMicros > LINE_BUDGET_MICROS) {
+                std::cerr << "FAIL: line steps average over " << LINE_BUDGET_MICROS << " us" << std::endl;
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Times a frame of particle work (step plus recording the batch) with a steady particle count
+     * @details Bursts all over the pond top the pool back up every frame. Fails if a frame
+     * allocates after the warm-up or the mean frame is over the 60 FPS budget.
+     * @return int exit code
+     */
+    int runParticleTiming(const BenchConfig& config, const WorldMetrics& metrics)
+    {
+        const ParticleEmitter burst = {256, 0.5f, 4.0f, -1.5707964f, 3.1415927f, 30.0f, 90.0f, 2.0f, 5.0f, 0.05f, 0.97f, {200, 230, 255, 230}};
+        std::mt19937 rng(config.seed);
+        std::uniform_real_distribution<float> randomX(0.0f, metrics.screenW);
+        std::uniform_real_distribution<float> randomY(metrics.surfaceY, metrics.screenH);
+
+        ParticleSystem particles(config.particles);
+        RenderCommandBuffer commands;
+        std::vector<double> frameMicros;
+        frameMicros.reserve(PARTICLE_FRAMES);
+        AllocTracker::setEnabled(true);
+        AllocTracker::Counts steadyStart = AllocTracker::threadCounts();
+
+        for (int frame = 0; frame < PARTICLE_WARMUP_FRAMES + PARTICLE_FRAMES; frame++) {
+            if (frame == PARTICLE_WARMUP_FRAMES) {
+                steadyStart = AllocTracker::threadCounts();
+            }
+            auto start = std::chrono::steady_clock::now();
+            while (particles.getLiveCount() < particles.getCapacity()) {
+                particles.emit(burst, Vector2D(randomX(rng), randomY(rng)), metrics.heightScale);
+            }
+            particles.step();
+            commands.reset();
+            particles.draw(commands);
+            if (frame >= PARTICLE_WARMUP_FRAMES) {
+                frameMicros.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+            }
+        }
+        uint64_t steadyAllocations = AllocTracker::threadCounts().allocations - steadyStart.allocations;
+        AllocTracker::setEnabled(false);
+
+        std::sort(frameMicros.begin(), frameMicros.end());
+        double total = 0.0;
+        for (double micros : frameMicros) {
+            total += micros;
+        }
+        double meanMs = total / frameMicros.size() / 1000.0;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Particles: " << config.particles << " live, " << PARTICLE_FRAMES << " frames" << std::endl;
+        std::cout << "  Frame ms: mean " << meanMs << "  p50 " << percentileMicros(frameMicros, 50) / 1000.0
+                  << "  p99 " << percentileMicros(frameMicros, 99) / 1000.0 << "  (step, refill and batch recording)" << std::endl;
+        if (steadyAllocations > 0) {
+            std::cerr << "FAIL: particle frames made " << steadyAllocations << " heap allocations after warm-up" << std::endl;
+            return 1;
+        }
+        if (meanMs > FRAME_BUDGET_MS) {
+            std::cerr << "FAIL: particle frames average over the 60 FPS frame budget" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Times a frame of waterline ripples at the largest window size: one step, rasterizing and copying the pixels
+     * @details The copy stands in for the texture update, which copies the strip once when recorded and once into
+     * the locked texture. Fails if the mean frame is over WATER_BUDGET_MICROS.
+     * @return int exit code
+     */
+    int runWaterTiming(const BenchConfig& config, const WorldMetrics& metrics)
+    {
+        int columns = static_cast<int>(std::ceil(Dimens::SCREEN_W_LARGE / Visuals::WATER_COLUMN_PIXELS));
+        WaterSurface water(columns, Visuals::WATER_TEXTURE_ROWS, metrics);
+        size_t pixelCount = static_cast<size_t>(columns) * water.getRows();
+        std::vector<uint32_t> recorded(pixelCount);
+        std::vector<uint32_t> texture(pixelCount);
+        std::mt19937 rng(config.seed);
+        std::uniform_real_distribution<float> randomX(0.0f, metrics.screenW);
+        std::uniform_real_distribution<float> randomStrength(-10.0f, 10.0f);
+
+        double totalMicros = 0.0;
+        for (int frame = 0; frame < WATER_FRAMES; frame++) {
+            if (frame % WATER_SPLASH_INTERVAL == 0) {
+                water.disturb(randomX(rng), randomStrength(rng) * metrics.heightScale);
+            }
+            auto start = std::chrono::steady_clock::now();
+            water.step();
+            water.rasterize();
+            std::copy(water.getPixels(), water.getPixels() + pixelCount, recorded.begin());
+            std::copy(recorded.begin(), recorded.end(), texture.begin());
+            totalMicros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        double frameMicros = totalMicros / WATER_FRAMES;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Water surface: " << columns << " columns x " << water.getRows() << " rows, "
+                  << WATER_FRAMES << " frames" << std::endl;
+        std::cout << "  " << frameMicros << " us/frame" << std::endl;
+        if (frameMicros > WATER_BUDGET_MICROS) {
+            std::cerr << "FAIL: water frames average over " << WATER_BUDGET_MICROS << " us" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Drives ResolutionScaler with render times from a simulated GPU whose load changes in phases
+     * @details Fails if the scaler takes more than MAX_RENDER_SETTLE_FRAMES to get back under budget after
+     * a load jump, or is still changing scale at the end of a phase.
+     * @return int exit code
+     */
+    int runRenderScaleSimulation(const BenchConfig& config)
+    {
+        ResolutionScaler scaler;
+        scaler.setBudget(FRAME_BUDGET_MS * Visuals::RENDER_BUDGET_SHARE);
+        std::mt19937 rng(config.seed);
+        std::uniform_real_distribution<double> noise(1.0 - RENDER_NOISE, 1.0 + RENDER_NOISE);
+
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Render scale: budget " << scaler.getBudget() << " ms, bounds " << Visuals::MIN_RENDER_SCALE
+                  << " to " << Visuals::MAX_RENDER_SCALE << std::endl;
+        bool failed = false;
+        for (const RenderLoadPhase& phase : RENDER_LOAD_PHASES) {
+            int settleFrames = -1;
+            int changes = 0;
+            int lastChange = 0;
+            for (int frame = 0; frame < phase.frames; frame++) {
+                float scale = scaler.getScale();
+                double renderMs = (phase.fixedMs + phase.fullScaleFillMs * scale * scale) * noise(rng);
+                if (settleFrames < 0 && renderMs <= scaler.getBudget()) {
+                    settleFrames = frame;
+                }
+                if (scaler.addSample(renderMs)) {
+                    changes++;
+                    lastChange = frame;
+                }
+            }
+            std::cout << "  " << phase.name << ": scale " << scaler.getScale() << ", within budget after "
+                      << settleFrames << " frame(s), " << changes << " change(s)" << std::endl;
+            if (settleFrames < 0 || settleFrames > MAX_RENDER_SETTLE_FRAMES) {
+                std::cerr << "FAIL: " << phase.name << " load took over " << MAX_RENDER_SETTLE_FRAMES << " frames to fit" << std::endl;
+                failed = true;
+            }
+            if (changes > 0 && lastChange > phase.frames - ResolutionScaler::GROW_DELAY * 2) {
+                std::cerr << "FAIL: scale still changing at the end of the " << phase.name << " load" << std::endl;
+                failed = true;
+            }
+        }
+        return failed ? 1 : 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--help" || arg == "-h") {
+                printUsage(argv[0]);
+                return 0;
+            }
+            else if (arg == "--rounds" && hasValue) {
+                config.rounds = std::stoi(argv[++i]);
+            }
+            else if (arg == "--day" && hasValue) {
+                config.day = std::stoi(argv[++i]);
+            }
+            else if (arg == "--rod" && hasValue) {
+                config.rodLevel = std::stoi(argv[++i]);
+            }
+            else if (arg == "--duration" && hasValue) {
+                config.roundDuration = std::stoi(argv[++i]);
+            }
+            else if (arg == "--seed" && hasValue) {
+                config.seed = static_cast<unsigned int>(std::stoul(argv[++i]));
+            }
+            else if (arg == "--bot" && hasValue) {
+                config.botName = argv[++i];
+            }
+            else if (arg == "--lanes" && hasValue) {
+                config.lanes = std::max(1, std::stoi(argv[++i]));
+            }
+            else if (arg == "--threads" && hasValue) {
+                config.threads = std::stoi(argv[++i]);
+            }
+            else if (arg == "--levels" && hasValue) {
+                config.levelTablePath = argv[++i];
+            }
+            else if (arg == "--check-allocs") {
+                config.checkAllocs = true;
+            }
+            else if (arg == "--floaters" && hasValue) {
+                config.floaters = std::stoi(argv[++i]);
+            }
+            else if (arg == "--school") {
+                config.school = true;
+            }
+            else if (arg == "--line") {
+                config.line = true;
+            }
+            else if (arg == "--particles" && hasValue) {
+                config.particles = std::stoi(argv[++i]);
+            }
+            else if (arg == "--water") {
+                config.water = true;
+            }
+            else if (arg == "--render-scale") {
+                config.renderScale = true;
+            }
+            else if (arg == "--pool" && hasValue) {
+                config.pool = std::stoi(argv[++i]);
+            }
+            else {
+                std::cerr << "Unknown argument: " << arg << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error parsing arguments: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::unique_ptr<Bot> bot = Bot::create(config.botName);
+    if (!bot) {
+        std::cerr << "Unknown bot: " << config.botName << std::endl;
+        return 1;
+    }
+
+    JobSystem::configureShared(config.pool);
+    WorldMetrics metrics = WorldMetrics::world();
+    if (config.floaters > 0) {
+        return runFloaterScaling(config, metrics);
+    }
+    if (config.school) {
+        return runSchoolScaling(config, metrics);
+    }
+    if (config.line) {
+        return runLineTiming(metrics);
+    }
+    if (config.particles > 0) {
+        return runParticleTiming(config, metrics);
+    }
+    if (config.water) {
+        return runWaterTiming(config, metrics);
+    }
+    if (config.renderScale) {
+        return runRenderScaleSimulation(config);
+    }
+    LevelTable::global().loadFromFile(config.levelTablePath);
+    LevelParams level = LevelTable::global().getLevel(config.day);
+
+    std::vector<double> tickMicros;
+    tickMicros.reserve(static_cast<size_t>(config.rounds) * (config.roundDuration / BENCH_FRAME_MS + 2));
+    long long totalScore = 0;
+    BotObservation observation;
+    AllocTracker::setEnabled(config.checkAllocs);
+    auto benchStart = std::chrono::steady_clock::now();
+
+    for (int round = 0; round < config.rounds && config.lanes > 1; round++) {
+        // Every lane gets its own bot and seed; a tick is one frame of all lanes
+        LaneScheduler scheduler(config.threads);
+        for (int lane = 0; lane < config.lanes; lane++) {
+            std::shared_ptr<FishingLogic> logic = std::make_shared<FishingLogic>(
+                level, config.roundDuration, config.rodLevel, metrics, false, true);
+            logic->seedRandom(config.seed + round * config.lanes + lane);
+            logic->setRunning(true);
+            logic->spawnNewFloaters();
+            logic->resetRoundStartTime();
+            scheduler.addLane(logic, Bot::create(config.botName));
+        }
+
+        while (!scheduler.allFinished()) {
+            auto tickStart = std::chrono::steady_clock::now();
+            scheduler.tick(BENCH_FRAME_MS);
+            auto tickEnd = std::chrono::steady_clock::now();
+            tickMicros.push_back(std::chrono::duration<double, std::micro>(tickEnd - tickStart).count());
+        }
+        for (int lane = 0; lane < config.lanes; lane++) {
+            totalScore += scheduler.getLogic(lane).getCatchScore();
+        }
+        if (round == 0) {
+            AllocTracker::resetStats(); // First round warms up pools and caches
+        }
+    }
+
+    // With one lane and --check-allocs every tick is also recorded as a frame, as the game would draw it
+    HeadlessDisplay display;
+    WorldMetrics screenMetrics = WorldMetrics::fromCurrentScreen();
+    bool recordFrames = config.checkAllocs && config.lanes == 1;
+    if (recordFrames && !display.open(screenMetrics)) {
+        return 1;
+    }
+    RenderCommandBuffer commands;
+    uint64_t steadyFrames = 0;
+    uint64_t allocatingFrames = 0;
+
+    for (int round = 0; round < config.rounds && config.lanes == 1; round++) {
+        std::shared_ptr<FishingLogic> logic = std::make_shared<FishingLogic>(
+            level, config.roundDuration, config.rodLevel, metrics, false, true);
+        logic->seedRandom(config.seed + round);
+        logic->setRunning(true);
+        logic->spawnNewFloaters();
+        logic->resetRoundStartTime();
+        std::unique_ptr<FishingView> view;
+        if (recordFrames) {
+            view = std::make_unique<FishingView>(logic, display.window, display.renderer, screenMetrics);
+        }
+
+        while (logic->getRunning()) {
+            AllocTracker::Counts frameStart = AllocTracker::threadCounts();
+            auto tickStart = std::chrono::steady_clock::now();
+            logic->observe(observation);
+            logic->handleUserInput(bot->nextAction(observation));
+            logic->update();
+            auto tickEnd = std::chrono::steady_clock::now();
+            tickMicros.push_back(std::chrono::duration<double, std::micro>(tickEnd - tickStart).count());
+            if (view) {
+                commands.reset();
+                view->drawView(commands);
+            }
+            if (round > 0 && recordFrames) {
+                steadyFrames++;
+                if (AllocTracker::threadCounts().allocations != frameStart.allocations) {
+                    allocatingFrames++;
+                }
+            }
+            logic->advanceClock(BENCH_FRAME_MS);
+        }
+        totalScore += logic->getCatchScore();
+        if (round == 0) {
+            AllocTracker::resetStats(); // First round warms up pools and caches
+        }
+    }
+
+    double totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - benchStart).count();
+    if (tickMicros.empty()) {
+        std::cout << "No ticks run" << std::endl;
+        return 0;
+    }
+
+    double sum = 0.0;
+    for (double micros : tickMicros) {
+        sum += micros;
+    }
+    std::sort(tickMicros.begin(), tickMicros.end());
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Bench: " << config.rounds << " rounds, day " << config.day << ", rod " << config.rodLevel
+              << ", bot '" << bot->getName() << "', " << config.lanes << " lane(s)" << std::endl;
+    std::cout << "  Ticks: " << tickMicros.size() << " in " << totalSeconds << " s ("
+              << tickMicros.size() / totalSeconds << " ticks/s)" << std::endl;
+    std::cout << "  Tick us: mean " << sum / tickMicros.size()
+              << "  p50 " << percentileMicros(tickMicros, 50)
+              << "  p99 " << percentileMicros(tickMicros, 99)
+              << "  max " << tickMicros.back() << std::endl;
+    std::cout << "  Mean score: " << static_cast<double>(totalScore) / (config.rounds * config.lanes) << std::endl;
+
+    if (config.checkAllocs) {
+        AllocTracker::setEnabled(false);
+        AllocTracker::report(std::cout);
+        bool allocated = false;
+        if (allocatingFrames > 0) {
+            std::cerr << "FAIL: " << allocatingFrames << " of " << steadyFrames << " recorded frames allocated after warm-up" << std::endl;
+            allocated = true;
+        }
+        for (const char* zone : STEADY_STATE_ZONES) {
+            AllocTracker::ZoneStats stats;
+            if (AllocTracker::getZoneStats(zone, stats) && stats.allocatingCalls > 0) {
+                std::cerr << "FAIL: " << zone << " allocated in " << stats.allocatingCalls << " calls after warm-up" << std::endl;
+                allocated = true;
+            }
+        }
+        if (allocated) {
+            return 1;
+        }
+        if (recordFrames) {
+            std::cout << "  " << steadyFrames << " steady-state frames recorded without heap allocations" << std::endl;
+        }
+        std::cout << "  Steady-state ticks made no heap allocations, job system helpers included" << std::endl;
+    }
+    return 0;
+}
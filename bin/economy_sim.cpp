@@ -0,0 +1,110 @@
+#include <SDL.h>
+#include <iostream>
+#include <string>
+#include "economy_sim.hpp"
+#include "game_constants.hpp"
+#include "level_config.hpp"
+
+namespace
+{
+    void printUsage(const char* program)
+    {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --campaigns N      Campaigns to simulate (default 1000)\n"
+                  << "  --threads N        Worker threads, 0 = all cores (default 0)\n"
+                  << "  --max-days N       Day limit before a campaign counts as stalled (default 100)\n"
+                  << "  --seed N           Base seed (default 1)\n"
+                  << "  --policy NAME      balanced, saver or upgrader (default balanced)\n"
+                  << "  --bot NAME         Bot that plays the fishing rounds (default greedy)\n"
+                  << "  --reserve N        Cash the player never spends below\n"
+                  << "  --loan-first       Pay loan installments before upgrades\n"
+                  << "  --max-rod N        Rod upgrade cap\n"
+                  << "  --max-clock N      Clock upgrade cap\n"
+                  << "  --max-register N   Register upgrade cap\n"
+                  << "  --max-ledger N     Ledger upgrade cap\n"
+                  << "  --levels PATH      Level table to simulate" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    SimConfig config;
+    std::string levelTablePath = Resource::LEVEL_TABLE;
+
+    // Policy first so the individual overrides below apply on top of it
+    for (int i = 1; i < argc - 1; i++) {
+        if (std::string(argv[i]) == "--policy" && !PurchasePolicy::fromName(argv[i + 1], config.policy)) {
+            std::cerr << "Unknown policy: " << argv[i + 1] << std::endl;
+            return 1;
+        }
+    }
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--help" || arg == "-h") {
+                printUsage(argv[0]);
+                return 0;
+            }
+            else if (arg == "--loan-first") {
+                config.policy.loanFirst = true;
+            }
+            else if (arg == "--campaigns" && hasValue) {
+                config.campaigns = std::stoi(argv[++i]);
+            }
+            else if (arg == "--threads" && hasValue) {
+                config.threads = std::stoi(argv[++i]);
+            }
+            else if (arg == "--max-days" && hasValue) {
+                config.maxDays = std::stoi(argv[++i]);
+            }
+            else if (arg == "--seed" && hasValue) {
+                config.seed = static_cast<unsigned int>(std::stoul(argv[++i]));
+            }
+            else if (arg == "--policy" && hasValue) {
+                i++; // Already applied
+            }
+            else if (arg == "--bot" && hasValue) {
+                config.botName = argv[++i];
+            }
+            else if (arg == "--reserve" && hasValue) {
+                config.policy.cashReserve = std::stoi(argv[++i]);
+            }
+            else if (arg == "--max-rod" && hasValue) {
+                config.policy.maxRodLevel = std::stoi(argv[++i]);
+            }
+            else if (arg == "--max-clock" && hasValue) {
+                config.policy.maxClockLevel = std::stoi(argv[++i]);
+            }
+            else if (arg == "--max-register" && hasValue) {
+                config.policy.maxRegisterLevel = std::stoi(argv[++i]);
+            }
+            else if (arg == "--max-ledger" && hasValue) {
+                config.policy.maxLedgerLevel = std::stoi(argv[++i]);
+            }
+            else if (arg == "--levels" && hasValue) {
+                levelTablePath = argv[++i];
+            }
+            else {
+                std::cerr << "Unknown argument: " << arg << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error parsing arguments: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (!Bot::create(config.botName)) {
+        std::cerr << "Unknown bot: " << config.botName << std::endl;
+        return 1;
+    }
+
+    LevelTable::global().loadFromFile(levelTablePath);
+
+    EconomySimulator simulator(config);
+    std::vector<CampaignResult> results = simulator.run();
+    simulator.printReport(results, std::cout);
+    return 0;
+}
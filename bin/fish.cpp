@@ -4,11 +4,23 @@
 #include <string>
 #include "process_manager.hpp"
 #include "game_constants.hpp"
+#include "level_config.hpp"
+#include "bot.hpp"
 
 int main(int argc, char* argv[]) {
     // Set default resolution
     float width = Dimens::SCREEN_W_MED;  
     float height = Dimens::SCREEN_H_MED;
+    std::string levelTablePath = Resource::LEVEL_TABLE;
+    std::string botName; // Empty = keyboard play
+    int laneCount = 1; // Player's pond plus bot-played rivals
+    bool renderThread = false; // Replay and present frames off the game thread
+    bool latencyReport = false; // Print frame and input-to-photon timings on exit
+    bool allocReport = false; // Print heap allocations per frame and zone on exit
+    PacingMode pacing = PacingMode::AUTO;
+    int targetFps = 0; // 0 = display refresh rate
+    float minRenderScale = Visuals::MIN_RENDER_SCALE; // Fishing scene resolution bounds, 1 = the window's
+    float maxRenderScale = Visuals::MAX_RENDER_SCALE;
     
     // First check for config file
     std::ifstream configFile("game_config.txt");
@@ -30,6 +42,18 @@ int main(int argc, char* argv[]) {
                     } else if (key == "resolution_height") {
                         height = std::stof(value);
                         std::cout << "Loaded height: " << height << std::endl;
+                    } else if (key == "level_table") {
+                        levelTablePath = value;
+                        std::cout << "Loaded level table path: " << levelTablePath << std::endl;
+                    } else if (key == "target_fps") {
+                        targetFps = std::stoi(value);
+                        std::cout << "Loaded target fps: " << targetFps << std::endl;
+                    } else if (key == "min_render_scale") {
+                        minRenderScale = std::stof(value);
+                        std::cout << "Loaded min render scale: " << minRenderScale << std::endl;
+                    } else if (key == "max_render_scale") {
+                        maxRenderScale = std::stof(value);
+                        std::cout << "Loaded max render scale: " << maxRenderScale << std::endl;
                     }
                 }
             } catch (const std::exception& e) {
@@ -50,6 +74,45 @@ int main(int argc, char* argv[]) {
             height = std::stoi(argv[i + 1]);
             i++;
         }
+        else if (std::string(argv[i]) == "--levels" && i + 1 < argc) {
+            levelTablePath = argv[i + 1];
+            i++;
+        }
+        else if (std::string(argv[i]) == "--bot" && i + 1 < argc) {
+            botName = argv[i + 1];
+            i++;
+        }
+        else if (std::string(argv[i]) == "--lanes" && i + 1 < argc) {
+            laneCount = std::stoi(argv[i + 1]);
+            i++;
+        }
+        else if (std::string(argv[i]) == "--render-thread") {
+            renderThread = true;
+        }
+        else if (std::string(argv[i]) == "--latency") {
+            latencyReport = true;
+        }
+        else if (std::string(argv[i]) == "--alloc-report") {
+            allocReport = true;
+        }
+        else if (std::string(argv[i]) == "--fps" && i + 1 < argc) {
+            targetFps = std::stoi(argv[i + 1]);
+            i++;
+        }
+        else if (std::string(argv[i]) == "--uncapped") {
+            pacing = PacingMode::UNCAPPED;
+        }
+        else if (std::string(argv[i]) == "--power-saver") {
+            pacing = PacingMode::POWER_SAVER;
+        }
+        else if (std::string(argv[i]) == "--min-render-scale" && i + 1 < argc) {
+            minRenderScale = std::stof(argv[i + 1]);
+            i++;
+        }
+        else if (std::string(argv[i]) == "--max-render-scale" && i + 1 < argc) {
+            maxRenderScale = std::stof(argv[i + 1]);
+            i++;
+        }
     }
 
     std::cout << "Launching with resolution: " + std::to_string(width) + "x" + std::to_string(height) << std::endl;
@@ -60,9 +123,24 @@ int main(int argc, char* argv[]) {
     Dimens::CENTER_X = width/2;
     Dimens::CENTER_Y = height/2;
     
+    // Load level table once, keeps built-in levels if the file is missing
+    LevelTable::global().loadFromFile(levelTablePath);
+    
     // Create and run the game
     try {
-        ProcessManager gameManager;
+        ProcessManager gameManager(renderThread, pacing, targetFps);
+        if (!botName.empty()) {
+            std::unique_ptr<Bot> bot = Bot::create(botName);
+            if (!bot) {
+                std::cerr << "Unknown bot: " << botName << std::endl;
+                return 1;
+            }
+            gameManager.setBot(std::move(bot));
+        }
+        gameManager.setLaneCount(laneCount);
+        gameManager.setLatencyReport(latencyReport);
+        gameManager.setAllocReport(allocReport);
+        gameManager.setRenderScaleBounds(minRenderScale, maxRenderScale);
         gameManager.run();
         return 0;
     } catch (const std::exception& e) {
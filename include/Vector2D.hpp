@@ -1,22 +1,49 @@
 #ifndef VECTOR2D_HPP
 #define VECTOR2D_HPP
 
-#include <cmath>
+#include <cmath> // For length
+#include <type_traits> // For layout checks
 
-class Vector2D {
-    private: 
-        float x, y;
+/**
+ * @struct Vector2D
+ * @brief 2D float vector; header-only, constexpr and trivially copyable
+ * @details Two packed floats with no padding, so arrays of Vector2D can be read as
+ * interleaved x/y floats.  All operators are component-wise.
+ */
+struct Vector2D
+{
+    float x;
+    float y;
 
-    public: 
-        Vector2D(float x, float y) : x(x), y(y) {}
+    constexpr Vector2D() : x(0.0f), y(0.0f) {}
+    constexpr Vector2D(float x, float y) : x(x), y(y) {}
 
-        Vector2D operator+(const Vector2D& addend) const { return Vector2D(x + addend.x, y + addend.y); }
-        Vector2D operator*(const Vector2D& factor) const { return Vector2D(x * factor.x, y * factor.y); }
-        Vector2D& operator+=(const Vector2D& addend);
-        Vector2D& operator=(const Vector2D& other);
-        const float& operator[](int index) const; // allows read access
-        float& operator[](int index); // allows write access
+    constexpr Vector2D operator+(const Vector2D& other) const { return Vector2D(x + other.x, y + other.y); }
+    constexpr Vector2D operator-(const Vector2D& other) const { return Vector2D(x - other.x, y - other.y); }
+    constexpr Vector2D operator*(const Vector2D& other) const { return Vector2D(x * other.x, y * other.y); }
+    constexpr Vector2D operator/(const Vector2D& other) const { return Vector2D(x / other.x, y / other.y); }
+    constexpr Vector2D operator*(float scalar) const { return Vector2D(x * scalar, y * scalar); }
+    constexpr Vector2D operator/(float scalar) const { return Vector2D(x / scalar, y / scalar); }
+    constexpr Vector2D operator-() const { return Vector2D(-x, -y); }
 
+    constexpr Vector2D& operator+=(const Vector2D& other) { x += other.x; y += other.y; return *this; }
+    constexpr Vector2D& operator-=(const Vector2D& other) { x -= other.x; y -= other.y; return *this; }
+    constexpr Vector2D& operator*=(const Vector2D& other) { x *= other.x; y *= other.y; return *this; }
+    constexpr Vector2D& operator/=(const Vector2D& other) { x /= other.x; y /= other.y; return *this; }
+    constexpr Vector2D& operator*=(float scalar) { x *= scalar; y *= scalar; return *this; }
+    constexpr Vector2D& operator/=(float scalar) { x /= scalar; y /= scalar; return *this; }
 
+    constexpr bool operator==(const Vector2D& other) const { return x == other.x && y == other.y; }
+    constexpr bool operator!=(const Vector2D& other) const { return !(*this == other); }
+
+    constexpr float dot(const Vector2D& other) const { return x * other.x + y * other.y; }
+    constexpr float lengthSquared() const { return x * x + y * y; }
+    float length() const { return std::sqrt(lengthSquared()); }
 };
-#endif // VECTOR2D_HPP
\ No newline at end of file
+
+constexpr Vector2D operator*(float scalar, const Vector2D& vector) { return vector * scalar; }
+
+static_assert(std::is_trivially_copyable<Vector2D>::value, "Vector2D must stay trivially copyable");
+static_assert(sizeof(Vector2D) == 2 * sizeof(float), "Vector2D must stay two packed floats");
+
+#endif // VECTOR2D_HPP
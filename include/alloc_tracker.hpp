@@ -0,0 +1,101 @@
+// Heap allocation counting for the bench and --alloc-report, attributed per frame and per zone
+#ifndef ALLOC_TRACKER_HPP
+#define ALLOC_TRACKER_HPP
+
+#include <cstdint> // For counters
+#include <cstddef> // For size_t
+#include <ostream> // For the report
+
+/**
+ * @namespace AllocTracker
+ * @brief Counts operator new calls while enabled
+ * @details Linking alloc_tracker.cpp replaces the global operator new/delete with versions
+ * that bump per-thread counters. Counting is off until setEnabled(true), so the only cost
+ * in normal play is one relaxed load per allocation. Zones and frames read the calling
+ * thread's counters, so unrelated work on other threads is never blamed on them. Work a
+ * thread hands to JobSystem is the exception: each job runs under an AllocCharge that moves
+ * its allocations to the submitting thread's account, so a zone around a parallelFor sees
+ * what its helpers allocated. Threads started by hand are still not followed.
+ */
+namespace AllocTracker
+{
+    /**
+     * @struct Counts
+     * @brief Allocations and bytes requested
+     */
+    struct Counts
+    {
+        uint64_t allocations;
+        uint64_t bytes;
+    };
+
+    /**
+     * @struct ZoneStats
+     * @brief Totals for one named zone since the last reset
+     */
+    struct ZoneStats
+    {
+        const char* name;
+        uint64_t calls;
+        uint64_t allocatingCalls;   // Calls that allocated at least once
+        uint64_t allocations;
+        uint64_t bytes;
+    };
+
+    struct Account; // Allocations charged to a thread by work it handed to others
+
+    const int MAX_ZONES = 32; // Fixed so the tracker itself never allocates
+
+    void setEnabled(bool enabled);
+    bool isEnabled();
+    Counts threadCounts();
+    Account* threadAccount();
+
+    void beginFrame();
+    void endFrame();
+
+    bool getZoneStats(const char* name, ZoneStats& stats);
+    void resetStats();
+    void report(std::ostream& out);
+}
+
+/**
+ * @class AllocZone
+ * @brief Scoped profiling zone; adds the allocations made on this thread while alive to a named total
+ * @details The name is stored, not copied, so pass a string literal. Zones may nest; the
+ * inner zone's allocations count towards both.
+ */
+class AllocZone
+{
+    public:
+        explicit AllocZone(const char* name);
+        ~AllocZone();
+        AllocZone(const AllocZone&) = delete;
+        AllocZone& operator=(const AllocZone&) = delete;
+
+    private:
+        int zone; // -1 when tracking is off or the zone table is full
+        AllocTracker::Counts start;
+};
+
+/**
+ * @class AllocCharge
+ * @brief Moves the allocations made on this thread while alive to another thread's account
+ * @details The other thread's zones and frames then count them as their own, and any zone open
+ * here does not. Does nothing when the account is this thread's own. The account's thread must
+ * outlive the charge; JobSystem guarantees that by charging the thread that waits on the job.
+ */
+class AllocCharge
+{
+    public:
+        explicit AllocCharge(AllocTracker::Account* account);
+        ~AllocCharge();
+        AllocCharge(const AllocCharge&) = delete;
+        AllocCharge& operator=(const AllocCharge&) = delete;
+
+    private:
+        AllocTracker::Account* account; // nullptr when charging this thread
+        AllocTracker::Counts start;
+};
+
+#endif // ALLOC_TRACKER_HPP
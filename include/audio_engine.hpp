@@ -0,0 +1,100 @@
+// Sound effects mixed on SDL_mixer's audio thread from a fixed voice pool
+#ifndef AUDIO_ENGINE_HPP
+#define AUDIO_ENGINE_HPP
+
+#include <atomic> // For drop counters
+#include <cstdint> // For voice serials
+#include <SDL.h>
+#include <SDL_mixer.h>
+#include "spsc_ring.hpp"
+#include "fishing_events.hpp" // For event sounds
+#include "frame_telemetry.hpp" // For latency samples
+
+enum class SoundId {
+    CAST,
+    HOOK,
+    CATCH,
+    RELEASE,
+    HAZARD_HIT,
+    STUN,
+    COUNT
+};
+
+/**
+ * @class AudioEngine
+ * @brief Plays sound effects with a lock-free trigger from the game thread
+ * @details open() decodes every effect once into Mix_Chunks in the device format. trigger()
+ * only pushes a small record into a single-producer ring, so it never locks or allocates.
+ * The engine mixes its own voices in SDL_mixer's post-mix callback: each callback drains
+ * the ring, starts one voice per trigger (stealing the lowest-priority, oldest voice when
+ * all are busy, or dropping the trigger if every voice outranks it), and adds the voices
+ * into the output with saturation. Trigger-to-output latency is the time from trigger() to
+ * the callback that first mixes the sound, plus the one buffer the device still has queued;
+ * samples come back through a second ring for collectLatencies().
+ */
+class AudioEngine
+{
+    public:
+        AudioEngine() = default;
+        ~AudioEngine();
+        AudioEngine(const AudioEngine&) = delete;
+        AudioEngine& operator=(const AudioEngine&) = delete;
+
+        bool open();
+        void close();
+        bool isOpen() const { return opened; }
+
+        bool trigger(SoundId sound);
+        void triggerEvent(FishingEventType type);
+        void collectLatencies(FrameTelemetry& telemetry);
+        uint32_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+        static const int VOICES = 16;
+        static const int SAMPLE_RATE = 44100;
+        static const int BUFFER_FRAMES = 512;   // About 12 ms at 44.1 kHz; smaller buffers underrun on some drivers
+
+    private:
+        /**
+         * @struct Trigger
+         * @brief A sound request and when it was made, in performance counter ticks
+         */
+        struct Trigger
+        {
+            SoundId sound;
+            Uint64 time;
+        };
+
+        /**
+         * @struct Voice
+         * @brief One playing sound; audio thread only
+         */
+        struct Voice
+        {
+            const Sint16* samples;  // Null when free
+            int length;             // In samples, all channels
+            int position;
+            int priority;
+            uint32_t serial;        // Start order, for stealing the oldest
+        };
+
+        static const size_t RING_CAPACITY = 64;
+        static const int SOUNDS = static_cast<int>(SoundId::COUNT);
+
+        bool opened = false;
+        Mix_Chunk* chunks[SOUNDS] = {};
+        SpscRing<Trigger, RING_CAPACITY> triggers;  // Game thread to audio thread
+        SpscRing<double, RING_CAPACITY> latencies;  // Audio thread to game thread, ms
+        std::atomic<uint32_t> dropped{0};           // Triggers lost to a full ring or busy voices
+
+        // Audio thread only
+        Voice voices[VOICES] = {};
+        uint32_t nextSerial = 0;
+        double bufferMs = 0.0;                      // Output still queued ahead of a callback's buffer
+        Uint64 counterFrequency = 1;
+
+        static void postMix(void* engine, Uint8* stream, int length);
+        void mix(Sint16* out, int samples);
+        void start(const Trigger& request);
+};
+
+#endif // AUDIO_ENGINE_HPP
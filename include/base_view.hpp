@@ -10,6 +10,7 @@
 #include <memory>
 #include "game_constants.hpp"
 #include "texture_manager.hpp"
+#include "render_commands.hpp"
 #include "scaling.hpp"
 using namespace std;
 #include "game_notifier.hpp"
@@ -29,19 +30,19 @@ class BaseView{
         SDL_Renderer* renderer;
         TTF_Font* font;
         TTF_Font* hoverFont;
+        int fontSize;
         SDL_Color color;
-        std::unordered_map<std::string, SDL_Texture*> textureCache; 
         TextureManager textureManager;
+        AnimationId backgroundAnimation = NO_ANIMATION; // Registered by views with an animated background
     
         void initializeFonts();
         void cleanupFonts();
-        void write(const std::string& text, int x, int y);
-        SDL_Texture* getCachedTexture(const std::string& text);
+        void write(RenderCommandBuffer& commands, const std::string& text, int x, int y);
 
     public:
         BaseView(const shared_ptr<GameNotifier>& notifier, SDL_Window* window, SDL_Renderer* renderer);
         virtual ~BaseView();
-        virtual void render() = 0;
+        virtual void render(RenderCommandBuffer& commands) = 0;
         virtual void input(SDL_Event &e) = 0;
         virtual void updateResolution() {}
         void updateRenderer(SDL_Renderer* newRenderer);
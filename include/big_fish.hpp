@@ -6,10 +6,11 @@ class BigFish : public Fish {
 public:
     BigFish(float w, float h, float xSpeed) : Fish(w, h, xSpeed, Resource::FISH_BIG_ID) {}
     void update() override;
+    FloaterKind getKind() const override { return FloaterKind::BIG_FISH; }
     
     // Override animation frame IDs
-    std::string getAnimFrame1ID() const override { return Resource::FISH_BIG_ANIM1_ID; }
-    std::string getAnimFrame2ID() const override { return Resource::FISH_BIG_ANIM2_ID; }
+    const std::string& getAnimFrame1ID() const override { return Resource::FISH_BIG_ANIM1_ID; }
+    const std::string& getAnimFrame2ID() const override { return Resource::FISH_BIG_ANIM2_ID; }
 };
 
 #endif // BIG_FISH_HPP
\ No newline at end of file
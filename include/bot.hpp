@@ -0,0 +1,80 @@
+// Scripted players that drive the rod for load and balance testing
+#ifndef BOT_HPP
+#define BOT_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "floater.hpp"
+#include "view_adapter.hpp"
+#include "Vector2D.hpp"
+
+/**
+ * @struct FloaterObservation
+ * @brief What a bot can see of one active floater
+ */
+struct FloaterObservation
+{
+    FloaterKind kind;
+    Vector2D position; // Top left corner, same as Floater
+    Vector2D velocity; // Pixels per tick
+    Vector2D dimens;
+};
+
+/**
+ * @struct BotObservation
+ * @brief Snapshot of the fishing round handed to a bot each tick (see FishingLogic::observe)
+ */
+struct BotObservation
+{
+    Vector2D rodPosition; // Center of the hook
+    float rodHalfWidth = 0.0f;
+    float rodHalfHeight = 0.0f;
+    float rodSpeed = 0.0f;  // Pixels per tick, including heavy hazard drag
+    float rodMinY = 0.0f;
+    float rodMaxY = 0.0f;
+    float surfaceY = 0.0f;
+    bool stunned = false;
+    bool fishHooked = false;
+    bool heavyHazardHooked = false;
+    int rodLevel = 0;
+
+    std::vector<FloaterObservation> fish;    // Active, uncaught fish
+    std::vector<FloaterObservation> hazards; // Active, uncaught hazards
+};
+
+/**
+ * @class Bot
+ * @brief Interface for scripted players; returns the input for one tick
+ */
+class Bot
+{
+    public:
+        virtual ~Bot() = default;
+        virtual UserInput::Action nextAction(const BotObservation& observation) = 0;
+        virtual std::string getName() const = 0;
+
+        // Builds a bot by name ("greedy"), nullptr if the name is unknown
+        static std::unique_ptr<Bot> create(const std::string& name);
+};
+
+/**
+ * @class GreedyBot
+ * @brief Chases whichever catchable fish it can reach soonest and dodges hazards on the way
+ * @details Each tick the candidate moves (toward the target, hold, away) are played forward a
+ * short window against the hazards' current velocities; the first move that stays clear wins.
+ */
+class GreedyBot : public Bot
+{
+    public:
+        UserInput::Action nextAction(const BotObservation& observation) override;
+        std::string getName() const override { return "greedy"; }
+
+    private:
+        static const int LOOKAHEAD_TICKS = 20;
+
+        bool findTarget(const BotObservation& observation, float& targetY) const;
+        int ticksUntilHazard(const BotObservation& observation, float rodVelocity) const;
+};
+
+#endif // BOT_HPP
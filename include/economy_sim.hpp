@@ -0,0 +1,82 @@
+// Monte Carlo simulation of whole campaigns for economy tuning
+#ifndef ECONOMY_SIM_HPP
+#define ECONOMY_SIM_HPP
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include "player_data.hpp"
+#include "bot.hpp"
+#include "world_metrics.hpp"
+
+/**
+ * @struct PurchasePolicy
+ * @brief How a simulated player spends cash in the store between days
+ */
+struct PurchasePolicy
+{
+    std::string name = "balanced";
+    int cashReserve = 20;   // Never spend below this much cash (rent buffer)
+    bool loanFirst = false; // Pay loan installments before buying upgrades
+    int maxRodLevel = 4;
+    int maxClockLevel = 2;
+    int maxRegisterLevel = 3;
+    int maxLedgerLevel = 2;
+
+    static bool fromName(const std::string& name, PurchasePolicy& policy);
+};
+
+/**
+ * @struct SimConfig
+ * @brief Parameters for a batch of simulated campaigns
+ */
+struct SimConfig
+{
+    int campaigns = 1000;
+    int threads = 0;        // 0 uses every core
+    int maxDays = 100;      // Campaigns still in debt after this are counted as stalled
+    unsigned int seed = 1;
+    std::string botName = "greedy"; // Bot that plays each fishing round
+    PurchasePolicy policy;
+    WorldMetrics metrics;   // Space the rounds are played in (the game's world space)
+
+    SimConfig();
+};
+
+/**
+ * @struct CampaignResult
+ * @brief Outcome of one simulated campaign from day 1
+ */
+struct CampaignResult
+{
+    bool victory = false;   // Loan paid off
+    bool gameOver = false;  // Went bankrupt first
+    int days = 0;           // Day the campaign ended on
+    int finalCash = 0;
+    int finalLoan = 0;
+    int totalFish = 0;
+};
+
+/**
+ * @class EconomySimulator
+ * @brief Plays full campaigns with headless fishing rounds across all cores
+ * @details Each campaign is seeded from its index, so results do not depend on the thread count
+ */
+class EconomySimulator
+{
+    public:
+        explicit EconomySimulator(const SimConfig& config);
+        std::vector<CampaignResult> run();
+        void printReport(const std::vector<CampaignResult>& results, std::ostream& out) const;
+
+        static CampaignResult playCampaign(const SimConfig& config, unsigned int seed);
+        static int playRound(const PlayerData& player, const WorldMetrics& metrics, Bot& bot, unsigned int seed);
+        static void visitStore(PlayerData& player, const PurchasePolicy& policy);
+
+    private:
+        SimConfig config;
+        int threadCount;
+        double lastRunSeconds = 0.0;
+};
+
+#endif // ECONOMY_SIM_HPP
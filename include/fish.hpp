@@ -9,10 +9,11 @@ class Fish : public Floater {
     public:
         Fish(float w, float h, float xSpeed, const std::string& spriteID = Resource::FISH_SMALL_ID) : Floater(w, h, xSpeed, spriteID) {}
         void update() override;
+        FloaterKind getKind() const override { return FloaterKind::SMALL_FISH; }
         
         // Animation-related methods
-        virtual std::string getAnimFrame1ID() const { return Resource::FISH_SMALL_ANIM1_ID; }
-        virtual std::string getAnimFrame2ID() const { return Resource::FISH_SMALL_ANIM2_ID; }
+        virtual const std::string& getAnimFrame1ID() const { return Resource::FISH_SMALL_ANIM1_ID; }
+        virtual const std::string& getAnimFrame2ID() const { return Resource::FISH_SMALL_ANIM2_ID; }
 };
 
 #endif // FISH_HPP
\ No newline at end of file
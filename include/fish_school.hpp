@@ -0,0 +1,83 @@
+// Separation, alignment and cohesion steering for schools of small fish
+#ifndef FISH_SCHOOL_HPP
+#define FISH_SCHOOL_HPP
+
+#include <vector> // For structure-of-arrays buffers and the cell table
+#include "fish.hpp"
+#include "floater_pool.hpp"
+#include "world_metrics.hpp"
+
+/**
+ * @class FishSchool
+ * @brief Steers a round's small fish as schools before they move
+ * @details Each tick the free small fish are copied, in slot order, into structure-of-arrays
+ * buffers sorted by grid cell with a counting sort. Cells are as wide as the neighbour radius
+ * and stored row-major, so a fish's neighbours are three contiguous runs of the buffers (the
+ * cell rows above, level with and below it); each run is tested four fish at a time with
+ * branch-free SSE2 code (scalar code in the same lane order elsewhere). Each fish only writes its own result, so steering runs across
+ * the job system and still gives the same answer for any thread count. Steering sets a fish's
+ * vertical speed and cruise speed but never turns it around, so schools still cross the pond.
+ * Medium and big fish keep their straight paths.
+ */
+class FishSchool
+{
+    public:
+        void reserve(size_t fishCount, const WorldMetrics& metrics);
+        void steer(FloaterPool<Fish>& fish, int maxThreads = 0);
+
+        int getSchoolingCount() const { return count; }
+
+        static const int LANES = 4; // Neighbours tested at once; one SSE register of floats
+
+    private:
+        /**
+         * @struct NeighbourSums
+         * @brief Running totals of one fish's neighbour tests, kept per lane
+         */
+        struct NeighbourSums
+        {
+            float flock[LANES];     // Neighbours heading the same way (the fish itself included)
+            float offsetX[LANES];   // Their summed offsets, for cohesion
+            float offsetY[LANES];
+            float sumVX[LANES];     // Their summed velocities, for alignment
+            float sumVY[LANES];
+            float pushX[LANES];     // Summed offsets away from fish too close, for separation
+            float pushY[LANES];
+        };
+
+        // Sorted by cell; index is the fish's place in cell order
+        std::vector<float> posX, posY, velX, velY;
+        std::vector<float> steeredX, steeredY;   // New velocity per fish
+        std::vector<int> slot;                   // Pool slot
+        std::vector<int> cell;
+
+        // Gathered in slot order before sorting
+        std::vector<int> gatheredSlot;
+        std::vector<int> gatheredCell;
+
+        std::vector<int> cellStart;              // First sorted fish of each cell, plus an end entry
+        std::vector<int> cellFill;               // Counting sort cursors
+        int gridW = 0;
+        int gridH = 0;
+        int count = 0;
+
+        // Fixed for the round
+        float cellSize = 1.0f;
+        float originX = 0.0f;                    // Left edge of the grid, a cell left of the screen
+        float radius2 = 1.0f;
+        float separationRadius = 1.0f;
+        float topY = 0.0f;                       // Highest and lowest a fish's top edge should go
+        float bottomY = 0.0f;
+        float edgeMargin = 0.0f;
+        float minSpeed = 0.0f;
+        float maxSpeed = 0.0f;
+        float maxVerticalSpeed = 0.0f;
+        float edgePush = 0.0f;
+
+        int cellFor(float x, float y) const;
+        void steerOne(int fish);
+        void accumulateRun(int first, int last, int fish, NeighbourSums& sums) const;
+        void accumulateOne(int j, int lane, float x, float y, float vx, float separation2, NeighbourSums& sums) const;
+};
+
+#endif // FISH_SCHOOL_HPP
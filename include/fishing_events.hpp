@@ -0,0 +1,54 @@
+// Gameplay moments the views and sounds react to (casts, catches, releases, hazard hits, stuns)
+#ifndef FISHING_EVENTS_HPP
+#define FISHING_EVENTS_HPP
+
+#include <cstdint> // For event numbers
+#include "Vector2D.hpp"
+
+enum class FishingEventType : uint8_t {
+    CAST,           // The hook went into the water
+    HOOKED,         // A fish bit the hook
+    LANDED,         // A fish or heavy hazard was pulled out of the water
+    KNOCKED_OFF,    // A hazard knocked a fish off the hook underwater
+    HAZARD_HIT,     // The hook ran into a hazard
+    STUNNED         // A shock hazard stunned the rod
+};
+
+/**
+ * @struct FishingEvent
+ * @brief One event and where it happened, world space
+ */
+struct FishingEvent
+{
+    FishingEventType type;
+    Vector2D position;
+};
+
+/**
+ * @class FishingEventQueue
+ * @brief Fixed ring of a round's latest events, numbered from 0 as they are pushed
+ * @details Copied whole into every snapshot, so a view that skips snapshots still sees each
+ * event once: it remembers the count it has handled and reads from there. Only the last
+ * CAPACITY events are kept, far more than a round produces between two frames.
+ */
+class FishingEventQueue
+{
+    public:
+        static const uint32_t CAPACITY = 32;
+
+        void push(FishingEventType type, const Vector2D& position)
+        {
+            events[count % CAPACITY] = {type, position};
+            count++;
+        }
+
+        uint32_t getCount() const { return count; }   // Events pushed this round
+        uint32_t getOldest() const { return count > CAPACITY ? count - CAPACITY : 0; } // Oldest number still held
+        const FishingEvent& get(uint32_t number) const { return events[number % CAPACITY]; }
+
+    private:
+        FishingEvent events[CAPACITY];
+        uint32_t count = 0;
+};
+
+#endif // FISHING_EVENTS_HPP
@@ -0,0 +1,57 @@
+// Verlet rope from the rod tip to the hook
+#ifndef FISHING_LINE_HPP
+#define FISHING_LINE_HPP
+
+#include "game_constants.hpp" // For the segment count
+#include "world_metrics.hpp"
+#include "Vector2D.hpp"
+
+/**
+ * @class FishingLine
+ * @brief Simulates the fishing line as a chain of Verlet points pinned to the rod tip and the hook
+ * @details Points are kept as structure-of-arrays floats padded to whole SSE registers. Each
+ * tick integrates every point with gravity and a damping picked branch-free by which side of
+ * the waterline it is on, then relaxes the segment lengths with a fixed number of Jacobi
+ * passes: every segment's correction is computed from the previous positions four at a time
+ * and then applied to both of its ends, so the passes vectorize (SSE2, or scalar code in the
+ * same order elsewhere) and always cost the same. Slack grows while the hook is reeled in and
+ * is pulled out by whatever hangs on the hook, so a heavy hazard drags the line taut.
+ */
+class FishingLine
+{
+    public:
+        static const int SEGMENTS = Game::LINE_SEGMENTS;
+        static const int POINTS = SEGMENTS + 1;
+        static const int LANES = 4; // Floats per SSE register
+
+        void reset(const Vector2D& tip, const Vector2D& hook, const WorldMetrics& metrics, float maxReelSpeed);
+        void step(const Vector2D& tip, const Vector2D& hook, float load, float sidePull);
+        void copyPoints(Vector2D* out) const;
+
+    private:
+        static_assert(SEGMENTS % LANES == 0, "Line segments must fill whole SSE registers");
+        static const int PADDED = (POINTS + LANES - 1) / LANES * LANES;
+
+        alignas(16) float x[PADDED];
+        alignas(16) float y[PADDED];
+        alignas(16) float prevX[PADDED];
+        alignas(16) float prevY[PADDED];
+        // Segment s's pull on its first point is stored at s + 1, so point k moves by corr[k + 1] - corr[k]
+        alignas(16) float corrX[PADDED];
+        alignas(16) float corrY[PADDED];
+
+        // Fixed for the round
+        float surfaceY = 0.0f;
+        float gravity = 0.0f;
+        float sideScale = 0.0f;
+        float reelSpeed = 1.0f;     // Hook speed that counts as reeling at full speed
+        float minLength = 1.0f;     // Shortest the whole line gets, so a raised hook still hangs
+
+        float lastHookY = 0.0f;
+
+        void pin(const Vector2D& tip, const Vector2D& hook);
+        void integrate(float pull, float drag);
+        void relax(float restLength);
+};
+
+#endif // FISHING_LINE_HPP
@@ -6,6 +6,7 @@
 #include <SDL.h> // For Uint
 #include <fstream> // For victory mode ez flag
 #include <functional>
+#include <random> // For round generator
 
 #include "rod.hpp"
 #include "fish.hpp"
@@ -15,10 +16,19 @@
 #include "heavy_hazard.hpp"
 #include "shock_hazard.hpp"
 #include "floater.hpp"
+#include "floater_pool.hpp"
 #include "game_constants.hpp"
 #include "view_adapter.hpp"
 #include "Vector2D.hpp"
+#include "level_config.hpp"
+#include "world_metrics.hpp"
+#include "fishing_snapshot.hpp"
+#include "fishing_events.hpp"
+#include "snapshot_buffer.hpp"
+#include "fish_school.hpp"
+#include "fishing_line.hpp"
 
+struct BotObservation; // See bot.hpp
 
 /**
  * @class FishingLogic
@@ -27,17 +37,18 @@
 class FishingLogic
 {
     private:
+        WorldMetrics metrics; // Fixed for the round; declared first so the rod can use it
         bool running = true;
         bool paused = false;
         // reserve vector capacity based on level chosen
-        std::vector<std::shared_ptr<Fish>> allFish;
+        FloaterPool<Fish> allFish;
         Rod rod;
-        std::vector<std::shared_ptr<Hazard>> hazards;
-        std::shared_ptr<Hazard> caughtHeavyHazardPtr;
+        FloaterPool<Hazard> hazards;
+        FloaterHandle caughtHeavyHazard; // Heavy hazard on the hook, null if none
         bool stunned = false;
         Uint32 stunEndTime = 0;
         int catchScore = 0; // initialize
-        std::shared_ptr<Fish> caughtFishPtr;
+        FloaterHandle caughtFish; // Fish on the hook, null if none
         std::vector<float> spawnLocations;
         int roundStartTime;
         int elapsedTime = 0;
@@ -50,17 +61,46 @@ class FishingLogic
         void spawnHazards();
         void initHazards(int numNormalHazards, int numHeavyHazards, int numShockHazards, float speedMultiplier);
         void initFish(int numSmallFish, int numMedFish, int numBigFish);
-        void initFishHazards(int dayCount, bool isHazardFree);
-        bool checkFloaterCaught(const std::vector<Vector2D>& floaterDetails);
+        void initFishHazards(const LevelParams& level, bool isHazardFree);
+        static bool isVictoryMode();
+        bool checkFloaterCaught(const Floater& floater) const;
+        FloaterHandle findFishCollision() const;
+        Fish* hookedFish() const { return allFish.get(caughtFish); }
+        Hazard* hookedHeavyHazard() const { return hazards.get(caughtHeavyHazard); }
         int lastCheckTime = 0;
         int roundDuration;
         int playerRodLevel;
+        int lastDebugOutput = 0;
+        uint32_t tickCount = 0; // update() calls while running, stamped on snapshots
+        SnapshotBuffer snapshots; // Published after every update for views
+        void step();
+        void publishSnapshot();
+
+        // Floater movement runs in chunks on the job system, offscreen floaters retire afterwards
+        std::vector<uint64_t> fishOffscreen;    // One bit per fish, one word per chunk
+        std::vector<uint64_t> hazardOffscreen;  // One bit per hazard, one word per chunk
+        int floaterThreads = 0;                 // Most threads for floater updates, 0 = whole pool
+        FishSchool school;                      // Steers small fish before they move
+        FishingLine line;                       // Rod tip to hook, stepped after the rod moves
+        FishingEventQueue events;               // Copied into every snapshot for effects
+        Vector2D lineTip() const { return Vector2D(rod.getPosition().x, metrics.scaleH(Visuals::ROD_TOP_PERCENT)); }
+        Vector2D lineHook() const { return rod.getPosition() - Vector2D(0.0f, metrics.rodRadiusY); }
+        void stepLine();
+        template <typename T>
+        void updateFloaters(FloaterPool<T>& pool, std::vector<uint64_t>& offscreen, bool moveCaught);
+
+        // Headless rounds run on a simulated clock with logging off (economy sims, bots)
+        bool headless;
+        Uint32 simulatedTicks = 1; // Starts above 0 so the round start time registers
+        std::mt19937 rng;
         
         // Callback handler for pause menu
         std::function<void(const std::string&)> notificationCallback;
 
     public:
-        FishingLogic(int dayCount, int roundDuration, int rodLevel);
+        FishingLogic(int dayCount, int roundDuration, int rodLevel, const WorldMetrics& metrics);
+        FishingLogic(const LevelParams& level, int roundDuration, int rodLevel, const WorldMetrics& metrics,
+                     bool isHazardFree = false, bool headless = false);
         void setRunning(bool newState) { running = newState; }
         bool getRunning() const { return running; }
         void setPaused(bool newState);
@@ -68,18 +108,38 @@ class FishingLogic
         int getCatchScore() const { return catchScore; }
         int getStartTime() const { return roundStartTime; }
         int getElapsedTime() const { return elapsedTime; }
-        Rod getRod() const { return rod; }
-        std::vector<std::shared_ptr<Hazard>>& getHazardsRef();
-        std::vector<std::shared_ptr<Fish>>& getAllFishRef();
+        bool isStunned() const { return stunned; }
+        bool hasCaughtFish() const { return hookedFish() != nullptr; }
+        bool hasCaughtHeavyHazard() const { return hookedHeavyHazard() != nullptr; }
+        FloaterHandle getCaughtFish() const { return caughtFish; }
+        FloaterHandle getCaughtHeavyHazard() const { return caughtHeavyHazard; }
+        int getRodLevel() const { return playerRodLevel; }
+        const Rod& getRod() const { return rod; }
+        const WorldMetrics& getMetrics() const { return metrics; }
+        const FishingEventQueue& getEvents() const { return events; }
+        FloaterPool<Hazard>& getHazardsRef();
+        FloaterPool<Fish>& getAllFishRef();
         void releaseFish();
         void releaseHeavyHazard();
         void spawnNewFloaters();
         void handleUserInput(UserInput::Action userInput);
         void update();
         int calculateRandNum(int lower, int upper);
-        float calculateRandSpeed(std::shared_ptr<Fish>& fishPtr);
+        float calculateRandSpeed(const Fish& fish);
         int getRoundDuration() const { return roundDuration; }
         void resetRoundStartTime();
+        void seedRandom(unsigned int seed);
+        void setFloaterThreads(int threads) { floaterThreads = threads; }
+        Uint32 getTicks() const;
+        void advanceClock(Uint32 ms);
+
+        // Bot support: floater/rod state for scripted input
+        void observe(BotObservation& out) const;
+        static bool canCatch(FloaterKind kind, int rodLevel);
+
+        // Render support: copies the visible state for views and other threads
+        void writeSnapshot(FishingSnapshot& out) const;
+        const FishingSnapshot& acquireSnapshot() { return snapshots.acquire(); } // Render thread only
         
         // Callback handler for pause menu
         void setCallback(std::function<void(const std::string&)> callback);
@@ -0,0 +1,48 @@
+// Read-only copy of a fishing round's visible state, for rendering
+#ifndef FISHING_SNAPSHOT_HPP
+#define FISHING_SNAPSHOT_HPP
+
+#include <cstdint> // For tick counter
+#include <vector> // For floater lists
+#include "floater.hpp" // For FloaterKind
+#include "game_constants.hpp" // For the line point count
+#include "fishing_events.hpp"
+#include "Vector2D.hpp"
+
+/**
+ * @struct FloaterSnapshot
+ * @brief What the view needs to draw one active floater
+ */
+struct FloaterSnapshot
+{
+    FloaterKind kind;
+    Vector2D position; // Top left corner, world space
+    Vector2D dimens;
+    bool facingRight;
+    bool caught;
+};
+
+/**
+ * @struct FishingSnapshot
+ * @brief Everything a view draws for one round, filled by FishingLogic::writeSnapshot
+ * @details Plain values only, so a snapshot can be read on one thread while the logic
+ * that wrote it keeps ticking on another. Vectors keep their capacity between writes.
+ */
+struct FishingSnapshot
+{
+    uint32_t tick = 0;       // update() count when written
+    Vector2D rodPosition;    // Center of the hook
+    Vector2D linePoints[Game::LINE_SEGMENTS + 1]; // Fishing line, rod tip first
+    bool running = false;
+    bool paused = false;
+    bool stunned = false;
+    int catchScore = 0;
+    int elapsedTime = 0;
+    int roundDuration = 0;
+    FishingEventQueue events; // Latest catches, releases and hits, for effects
+
+    std::vector<FloaterSnapshot> fish;    // Active fish, including a hooked one
+    std::vector<FloaterSnapshot> hazards; // Active hazards, including a hooked heavy hazard
+};
+
+#endif // FISHING_SNAPSHOT_HPP
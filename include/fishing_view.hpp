@@ -8,11 +8,17 @@
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include "texture_manager.hpp"
+#include "world_metrics.hpp"
+#include "render_commands.hpp"
+#include "particle_system.hpp"
+#include "water_surface.hpp"
 using namespace std;
 
 class FishingView{
     private:
-        int screenW, screenH;
+        WorldMetrics world;   // Simulation space the logic runs in
+        WorldMetrics screen;  // Window pixels, for the UI overlay
+        int scaledFontSize;   // Box text size, fixed per resolution
         int effectiveLevel;
         SDL_Window* window;
         SDL_Renderer* renderer;
@@ -21,25 +27,49 @@ class FishingView{
         const shared_ptr<FishingLogic> logicPtr;
         TextureManager textureManager;
         PauseMenu pauseMenu;
+
+        /**
+         * @struct FloaterSprites
+         * @brief Texture ids for one floater kind, resolved once after loading
+         */
+        struct FloaterSprites {
+            SpriteId still;     // Hooked (and non-animated hazards)
+            AnimationId swim;
+        };
+        static const int FLOATER_KINDS = static_cast<int>(FloaterKind::SHOCK_HAZARD) + 1;
+        FloaterSprites floaterSprites[FLOATER_KINDS]; // Indexed by FloaterKind
+        AnimationId backgroundAnimation = NO_ANIMATION;
+
+        // Effects for the player's pond, stepped once per logic tick
+        ParticleSystem particles;       // Splashes, bubbles and sparks
+        WaterSurface water;             // Waterline ripples
+        SDL_Texture* waterTexture = nullptr; // Streaming, refilled from water every frame
+        uint32_t handledEvents = 0;     // Snapshot events already turned into effects
+        uint32_t effectTick = 0;        // Snapshot tick the effects were last stepped to
+        float hookY;                    // Hook height last frame, to see it cross the waterline
+        void updateEffects(const FishingSnapshot& snapshot);
+        void drawWater(RenderCommandBuffer& commands);
         
-        void drawFish();
-        void drawHazard();
-        void drawFishingRod();
-        void drawScore();
-        void drawBackground();
-        void drawTimer();
-        void drawHitboxes();
-        void drawStyledBox(int x, int y, int width, int height, const std::string& text);
+        void drawWorld(RenderCommandBuffer& commands, const FishingSnapshot& snapshot, bool effects = false);
+        void drawFish(RenderCommandBuffer& commands, const FishingSnapshot& snapshot);
+        void drawHazard(RenderCommandBuffer& commands, const FishingSnapshot& snapshot);
+        void drawFishingRod(RenderCommandBuffer& commands, const FishingSnapshot& snapshot);
+        void drawScore(RenderCommandBuffer& commands, const FishingSnapshot& snapshot);
+        void drawBackground(RenderCommandBuffer& commands);
+        void drawTimer(RenderCommandBuffer& commands, const FishingSnapshot& snapshot);
+        void drawHitboxes(RenderCommandBuffer& commands, const FishingSnapshot& snapshot);
+        void drawStyledBox(RenderCommandBuffer& commands, int x, int y, int width, int height, const char* text);
         bool loadSprites();
         bool showHitboxes = false;
         
     public:
-        FishingView(const std::shared_ptr<FishingLogic>& logicPtr, SDL_Window* window, SDL_Renderer* renderer, float screenH, float screenW);
+        FishingView(const std::shared_ptr<FishingLogic>& logicPtr, SDL_Window* window, SDL_Renderer* renderer, const WorldMetrics& screen);
         ~FishingView();
-        void drawView(); 
+        void drawView(RenderCommandBuffer& commands, SDL_Texture* sceneTarget = nullptr, float sceneScale = 1.0f);
+        void drawPauseMenu(RenderCommandBuffer& commands);
+        void drawLane(RenderCommandBuffer& commands, const FishingSnapshot& snapshot, const SDL_Rect& viewport);
         UserInput::Action handleKeyboardInput(SDL_Event &e);
         void toggleHitboxes();
-        UserInput::Action handleContinuousInput();
         void handlePauseMenuInput(SDL_Event &e);
         void updateResolution(float newWidth, float newHeight);
 };
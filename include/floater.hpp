@@ -5,6 +5,20 @@
 #include "Vector2D.hpp"
 #include <string>
 
+/**
+ * @enum FloaterKind
+ * @brief Concrete floater type, so callers can tell floaters apart without dynamic_cast
+ */
+enum class FloaterKind
+{
+    SMALL_FISH,
+    MEDIUM_FISH,
+    BIG_FISH,
+    HAZARD,
+    HEAVY_HAZARD,
+    SHOCK_HAZARD
+};
+
 class Floater {
 
 // Note: to coordinate w sdl, xy pos represents top rightmost coordinate of floater object
@@ -33,22 +47,23 @@ class Floater {
         const std::string& getSpriteID() const { return spriteID; }
         
         // Getter & Setter methods to access positional information (2d vectors)
-        Vector2D getPosition() { return position; }
+        Vector2D getPosition() const { return position; }
         void setPosition(const Vector2D& newPos) { position = newPos; }
-        void setPosition(float x, float y) { position[0] = x; position[1] = y; }
+        void setPosition(float x, float y) { position = Vector2D(x, y); }
         
-        Vector2D getDirection() { return direction; }
+        Vector2D getDirection() const { return direction; }
         void setDirection(const Vector2D& newPos) { direction = newPos; }
-        void setDirection(float x, float y) { direction[0] = x; direction[1] = y; }
+        void setDirection(float x, float y) { direction = Vector2D(x, y); }
         
-        Vector2D getSpeed() { return speed; }
+        Vector2D getSpeed() const { return speed; }
         void setSpeed(const Vector2D& newPos) { speed = newPos; }
-        void setSpeed(float x, float y) { speed[0] = x; speed[1] = y; }
+        void setSpeed(float x, float y) { speed = Vector2D(x, y); }
         
-        Vector2D getDimens() { return dimens; }
+        Vector2D getDimens() const { return dimens; }
         void setDimens(const Vector2D& newPos) { dimens = newPos; }
-        void setDimens(float x, float y) { dimens[0] = x; dimens[1] = y; }
+        void setDimens(float x, float y) { dimens = Vector2D(x, y); }
         virtual void update() = 0;
+        virtual FloaterKind getKind() const = 0;
 };
 
 #endif // FLOATER_HPP 
\ No newline at end of file
@@ -0,0 +1,109 @@
+// Generational handles and the pool of floaters they index
+#ifndef FLOATER_POOL_HPP
+#define FLOATER_POOL_HPP
+
+#include <cstdint> // For packed handle bits
+#include <vector> // For slot storage
+#include <memory> // For owned floaters
+
+/**
+ * @class FloaterHandle
+ * @brief 32-bit reference to one life of a pooled floater: 16-bit slot index + 16-bit generation
+ * @details A slot's generation is bumped every time it is respawned, so a handle taken
+ * during an earlier life stops resolving instead of pointing at the wrong floater.
+ * Generation 0 is never used, which makes a default-constructed handle null.
+ */
+class FloaterHandle
+{
+    public:
+        constexpr FloaterHandle() : bits(0) {}
+        constexpr FloaterHandle(uint16_t index, uint16_t generation)
+            : bits((static_cast<uint32_t>(generation) << 16) | index) {}
+
+        constexpr uint16_t getIndex() const { return static_cast<uint16_t>(bits & 0xFFFFu); }
+        constexpr uint16_t getGeneration() const { return static_cast<uint16_t>(bits >> 16); }
+        constexpr bool isValid() const { return getGeneration() != 0; }
+        constexpr explicit operator bool() const { return isValid(); }
+
+        constexpr bool operator==(const FloaterHandle& other) const { return bits == other.bits; }
+        constexpr bool operator!=(const FloaterHandle& other) const { return bits != other.bits; }
+
+    private:
+        uint32_t bits;
+};
+
+/**
+ * @class FloaterPool
+ * @brief Fixed set of floaters for a round, addressed by index or by FloaterHandle
+ * @tparam T Floater base type stored (Fish or Hazard)
+ */
+template <typename T>
+class FloaterPool
+{
+    public:
+        /**
+         * @brief Adds a floater in a new slot
+         * @param floater Floater to own
+         * @return FloaterHandle handle to the floater's first life
+         */
+        FloaterHandle add(std::unique_ptr<T> floater)
+        {
+            slots.push_back(std::move(floater));
+            generations.push_back(1);
+            return handleAt(slots.size() - 1);
+        }
+
+        /**
+         * @brief Resolves a handle
+         * @param handle Handle to look up
+         * @return T* floater, nullptr if the handle is null or from an earlier life of the slot
+         */
+        T* get(FloaterHandle handle) const
+        {
+            size_t index = handle.getIndex();
+            if (!handle || index >= slots.size() || generations[index] != handle.getGeneration()) {
+                return nullptr;
+            }
+            return slots[index].get();
+        }
+
+        /**
+         * @brief Handle to the current life of a slot
+         * @param index Slot index
+         * @return FloaterHandle current handle for that slot
+         */
+        FloaterHandle handleAt(size_t index) const
+        {
+            return FloaterHandle(static_cast<uint16_t>(index), generations[index]);
+        }
+
+        /**
+         * @brief Starts a new life for a slot, invalidating all older handles to it
+         * @param index Slot index being respawned
+         * @return FloaterHandle handle to the new life
+         */
+        FloaterHandle respawn(size_t index)
+        {
+            uint16_t next = static_cast<uint16_t>(generations[index] + 1);
+            generations[index] = next == 0 ? 1 : next; // Skip the null generation on wraparound
+            return handleAt(index);
+        }
+
+        size_t size() const { return slots.size(); }
+        bool empty() const { return slots.empty(); }
+        void reserve(size_t count) { slots.reserve(count); generations.reserve(count); }
+
+        std::unique_ptr<T>& operator[](size_t index) { return slots[index]; }
+        const std::unique_ptr<T>& operator[](size_t index) const { return slots[index]; }
+
+        typename std::vector<std::unique_ptr<T>>::iterator begin() { return slots.begin(); }
+        typename std::vector<std::unique_ptr<T>>::iterator end() { return slots.end(); }
+        typename std::vector<std::unique_ptr<T>>::const_iterator begin() const { return slots.begin(); }
+        typename std::vector<std::unique_ptr<T>>::const_iterator end() const { return slots.end(); }
+
+    private:
+        std::vector<std::unique_ptr<T>> slots;
+        std::vector<uint16_t> generations;
+};
+
+#endif // FLOATER_POOL_HPP
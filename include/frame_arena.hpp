@@ -0,0 +1,93 @@
+// Bump allocator for data that only lives until the end of the current frame
+#ifndef FRAME_ARENA_HPP
+#define FRAME_ARENA_HPP
+
+#include <cstddef> // For size_t
+#include <string> // For ArenaString
+#include <vector> // For ArenaVector and the overflow blocks
+
+/**
+ * @class FrameArena
+ * @brief Hands out memory by bumping a pointer; everything is released at once by reset()
+ * @details Allocations never free individually. When a frame outgrows the current block a
+ * further block is chained on, and the next reset() merges them into one block large enough
+ * for the whole frame, so after the first few frames the arena stops calling malloc at all.
+ * Not thread safe: perFrame() belongs to the game thread, which resets it every loop.
+ */
+class FrameArena
+{
+    public:
+        explicit FrameArena(std::size_t initialBytes = DEFAULT_BYTES);
+        ~FrameArena();
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        static FrameArena& perFrame();
+
+        void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+        void reset();
+
+        const char* copy(const char* text, std::size_t length);
+        const char* format(const char* fmt, ...);
+
+        std::size_t getUsed() const { return used + overflowUsed; }
+        std::size_t getCapacity() const { return capacity; }
+        std::size_t getHighWater() const { return highWater; }
+
+        static const std::size_t DEFAULT_BYTES = 16 * 1024;
+
+    private:
+        char* block;                    // Main block, reused every frame
+        std::size_t capacity;
+        std::size_t used;
+
+        std::vector<char*> overflow;    // Extra blocks chained on this frame
+        char* overflowBlock;            // Overflow block currently being bumped
+        std::size_t overflowCapacity;
+        std::size_t overflowUsed;       // Bytes handed out from all overflow blocks
+        std::size_t overflowOffset;     // Bump offset into overflowBlock
+        std::size_t highWater;          // Most bytes used in one frame
+
+        void* allocateOverflow(std::size_t bytes, std::size_t alignment);
+};
+
+/**
+ * @class ArenaAllocator
+ * @brief Standard allocator that takes memory from a FrameArena; deallocate is a no-op
+ * @details Default-constructed allocators use FrameArena::perFrame(). Containers using it must
+ * not outlive the frame they were filled in.
+ */
+template <typename T>
+class ArenaAllocator
+{
+    public:
+        typedef T value_type;
+
+        ArenaAllocator() : arena(&FrameArena::perFrame()) {}
+        explicit ArenaAllocator(FrameArena& arena) : arena(&arena) {}
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.getArena()) {}
+
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+        }
+        void deallocate(T*, std::size_t) {}
+
+        FrameArena* getArena() const { return arena; }
+
+    private:
+        FrameArena* arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.getArena() == b.getArena(); }
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.getArena() != b.getArena(); }
+
+// Strings and vectors that live until the end of the frame
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>> ArenaString;
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+#endif // FRAME_ARENA_HPP
@@ -0,0 +1,57 @@
+// Decides how the main loop waits between frames: vsync, precise sleep-plus-spin, or not at all
+#ifndef FRAME_PACER_HPP
+#define FRAME_PACER_HPP
+
+#include <SDL.h> // For the window, renderer and performance counter
+
+enum class PacingMode {
+    AUTO,           // Vsync when the target is the display rate, otherwise sleep-plus-spin to the target
+    UNCAPPED,       // No vsync and no waiting
+    POWER_SAVER     // Half the display rate (at most 30 fps), sleeping only
+};
+
+/**
+ * @class FramePacer
+ * @brief Paces the game loop to a target frame rate without waiting twice per frame
+ * @details With vsync the present call already blocks until the display's next refresh, so
+ * sleeping as well drops frames; the pacer only waits itself when vsync is off, unavailable
+ * or not matching the target. Waits use the performance counter: SDL_Delay for the bulk of
+ * the wait, then a short spin so the frame starts on time despite millisecond sleep granularity.
+ */
+class FramePacer
+{
+    public:
+        explicit FramePacer(PacingMode mode = PacingMode::AUTO, int targetFps = 0);
+
+        void detectDisplay(SDL_Window* window);
+        bool wantsVsync() const;
+        void rendererCreated(SDL_Renderer* renderer);
+        void waitForNextFrame();
+
+        PacingMode getMode() const { return mode; }
+        int getRefreshRate() const { return refreshRate; }
+        int getTargetFps() const;
+        double getLastFrameMs() const { return lastFrameMs; }
+
+    private:
+        PacingMode mode;
+        int requestedFps;           // 0 = display refresh rate
+        int refreshRate = 60;       // Assumed until detectDisplay()
+        bool vsyncActive = false;   // Renderer actually presents with vsync
+        int shortVsyncFrames = 0;   // Consecutive frames far shorter than a refresh
+
+        Uint64 counterFrequency;
+        Uint64 frameDeadline = 0;   // Counter value the next frame should start at
+        Uint64 lastFrameStart = 0;
+        double lastFrameMs = 0.0;
+
+        // Spin this close to the deadline instead of trusting SDL_Delay
+        static constexpr double SPIN_MARGIN_MS = 2.0;
+        // Frames shorter than half a refresh in a row before vsync is considered broken
+        static const int MAX_SHORT_VSYNC_FRAMES = 30;
+
+        bool trustsVsync() const;
+        void waitUntil(Uint64 deadline) const;
+};
+
+#endif // FRAME_PACER_HPP
@@ -0,0 +1,37 @@
+// Frame time, input-to-photon, sound latency and render scale samples for the --latency report
+#ifndef FRAME_TELEMETRY_HPP
+#define FRAME_TELEMETRY_HPP
+
+#include <vector> // For samples
+#include <mutex> // Latency samples can come from the render thread
+#include <ostream> // For the report
+#include <SDL.h> // For Uint32
+
+/**
+ * @class FrameTelemetry
+ * @brief Collects per-frame timings and prints percentiles
+ * @details Input-to-photon latency is measured from an input's SDL event timestamp to the
+ * return of the SDL_RenderPresent that first shows a tick which applied it. Present returning
+ * is the closest the game can see to photons; display scan-out adds up to one more refresh.
+ */
+class FrameTelemetry
+{
+    public:
+        void recordFrame(double frameMs);
+        void recordInputLatency(Uint32 latencyMs);
+        void recordAudioLatency(double latencyMs);
+        void recordRenderScale(double replayMs, float scale);
+        void report(std::ostream& out) const;
+
+    private:
+        mutable std::mutex mutex;
+        std::vector<double> frameTimes;
+        std::vector<double> inputLatencies;
+        std::vector<double> audioLatencies;
+        std::vector<double> sceneReplayTimes;
+        std::vector<double> renderScales;
+
+        static void printStats(std::ostream& out, const char* label, std::vector<double> samples);
+};
+
+#endif // FRAME_TELEMETRY_HPP
@@ -18,6 +18,10 @@ namespace Dimens
     static const float SCREEN_W_MED = 1263.0f;
     static const float SCREEN_H_SMALL = 616.0f;
     static const float SCREEN_W_SMALL = 842.0f;
+
+    // Fixed simulation space the fishing round runs in; views scale it to the window
+    static const float WORLD_W = 1024.0f;
+    static const float WORLD_H = 768.0f;
 }
 
 // Mechanics-Related Values
@@ -60,9 +64,40 @@ namespace Game
     const int STARTING_RENT = 10;
 
     const float HEAVY_HAZARD_SLOW_FACTOR = 0.3f;
+
+    // Floater update chunking (see FishingLogic::updateFloaters)
+    const int FLOATER_CHUNK = 64;           // Floaters per chunk: one 64-bit offscreen mask, 8 cache lines of slots
+    const int PARALLEL_FLOATER_MIN = 1024;  // Floaters per job; smaller pools update on the calling thread
+
+    // Small fish schooling (see FishSchool); distances in fish widths, speeds scaled like fish speeds
+    const float SCHOOL_NEIGHBOR_RADIUS = 1.0f;      // Also the neighbour grid's cell size
+    const float SCHOOL_SEPARATION_RADIUS = 0.5f;
+    const float SCHOOL_SEPARATION_WEIGHT = 0.15f;
+    const float SCHOOL_ALIGNMENT_WEIGHT = 0.1f;
+    const float SCHOOL_COHESION_WEIGHT = 0.05f;
+    const float SCHOOL_EDGE_PUSH = 0.2f;            // Vertical steer away from the surface and the pond floor
+    const float SCHOOL_MIN_SPEED = MAX_FISH_SPEED - 2;
+    const float SCHOOL_MAX_VERTICAL_SPEED = 1.5f;
+    const int SCHOOL_STEER_GRAIN = 512;             // Fish per job when steering in parallel
+
+    // Fishing line (see FishingLine); slack is rest length over the straight tip-to-hook distance
+    const int LINE_SEGMENTS = 16;                   // A multiple of 4 so constraints run four at a time
+    const int LINE_ITERATIONS = 8;                  // Constraint passes per tick, fixed so the cost is too
+    const float LINE_SLACK = 1.1f;
+    const float LINE_REEL_SLACK = 0.2f;             // Extra slack while reeling in at full speed
+    const float LINE_GRAVITY = 0.3f;                // Per tick squared, scaled by height
+    const float LINE_AIR_DAMPING = 0.98f;           // Velocity kept per tick above the waterline
+    const float LINE_WATER_DAMPING = 0.85f;         // And below it
+    const float LINE_FISH_LOAD = 0.5f;              // Share of the slack a hooked fish pulls out
+    const float LINE_FISH_PULL = 0.15f;             // Sideways tug toward where a hooked fish faces, scaled by width
+    const float LINE_HAZARD_DRAG = 0.5f;            // Extra sink per unit of heavy hazard load
+
+    // Level Table Limits (days past the table are extrapolated up to these)
+    const int MAX_FLOATERS_PER_TYPE = 15;
+    const float MAX_HAZARD_SPEED_MULTIPLIER = 3.0f;
 }
 
-// Level spawn values
+// Level spawn values - built-in defaults, overridden at startup by Resource::LEVEL_TABLE
 namespace Level {
     namespace Day1 {
         const int SMALL_FISH = 4;
@@ -188,6 +223,12 @@ namespace Level {
 // Sprite Values
 namespace Visuals
 {
+    // Dynamic resolution for the fishing scene (see ResolutionScaler)
+    const float MIN_RENDER_SCALE = 0.5f;
+    const float MAX_RENDER_SCALE = 1.0f;
+    const float RENDER_SCALE_STEP = 0.05f;
+    const float RENDER_BUDGET_SHARE = 0.5f;   // Of the frame interval, for replaying and flushing a frame
+
     // Fish Values
     const float FISH_HEIGHT_PERCENT = 0.035f;
     const float FISH_WIDTH_PERCENT = 0.065f;
@@ -216,6 +257,20 @@ namespace Visuals
 
     // Misc
     const float SURFACE_POND_PERCENT = 0.54f; // Waterline
+    const float ROD_TOP_PERCENT = 0.04f; // Where the line leaves the rod tip
+
+    // Particles (see ParticleSystem)
+    const int PARTICLE_CAPACITY = 65536;    // Live particles per view
+    const int MAX_PARTICLE_STEPS = 4;       // Ticks caught up in one frame; longer gaps are dropped
+
+    // Waterline ripples (see WaterSurface)
+    const int WATER_COLUMN_PIXELS = 2;      // Window pixels per simulated column
+    const int WATER_TEXTURE_ROWS = 24;
+    const float WATER_BAND_PERCENT = 0.02f; // Half the ripple strip's height, also the tallest ripple
+    const float WATER_WAVE_SPEED = 0.3f;    // Squared wave speed in columns per tick; stable below 1
+    const float WATER_DAMPING = 0.99f;
+    const float WATER_HOOK_SPLASH = 2.0f;   // Dent per world unit the hook moves while crossing
+    const float WATER_LANDED_SPLASH = -10.0f; // Catches lift the water as they come out
 }
 
 // Color Presets
@@ -335,6 +390,9 @@ namespace Resource
     // Resource Paths
     const std::string RESOURCE_PATH = "../resource/";
 
+    // Level table (see level_config.hpp)
+    const std::string LEVEL_TABLE = RESOURCE_PATH + "levels.txt";
+
     // Fish animation sprites
     const std::string FISH_SMALL = RESOURCE_PATH + "fish_small.png";
     const std::string FISH_SMALL_ANIM1 = RESOURCE_PATH + "fish_small_animated.png";
@@ -372,6 +430,19 @@ namespace Resource
     const std::string BG_STORE_ANIM1 = RESOURCE_PATH + "bg_store_animated.png";
     const std::string BG_STORE_ANIM2 = RESOURCE_PATH + "bg_store_animated2.png";
 
+    // Sound effects (see AudioEngine); missing files just stay silent
+    const std::string SFX_CAST = RESOURCE_PATH + "sfx_cast.wav";
+    const std::string SFX_HOOK = RESOURCE_PATH + "sfx_hook.wav";
+    const std::string SFX_CATCH = RESOURCE_PATH + "sfx_catch.wav";
+    const std::string SFX_RELEASE = RESOURCE_PATH + "sfx_release.wav";
+    const std::string SFX_HAZARD_HIT = RESOURCE_PATH + "sfx_hazard_hit.wav";
+    const std::string SFX_STUN = RESOURCE_PATH + "sfx_stun.wav";
+
+    // Looping music streamed by MusicPlayer: 16-bit PCM WAV at 44.1 kHz
+    const std::string MUSIC_MENU = RESOURCE_PATH + "music_menu.wav";
+    const std::string MUSIC_STORE = RESOURCE_PATH + "music_store.wav";
+    const std::string MUSIC_FISHING = RESOURCE_PATH + "music_fishing.wav";
+
     // Resource IDs
     // Floater static IDs - fish deprecated
     const std::string FISH_SMALL_ID = "fish_small";
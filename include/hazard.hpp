@@ -9,9 +9,10 @@ class Hazard : public Floater {
     public:
         Hazard(float w, float h, float xSpeed) : Floater(w, h, xSpeed * 2.5f, Resource::HAZARD_BARRACUDA_ID) {}
         void update() override;
+        FloaterKind getKind() const override { return FloaterKind::HAZARD; }
 
-        virtual std::string getAnimFrame1ID() const { return Resource::HAZARD_BARRACUDA_ANIM1_ID; }
-        virtual std::string getAnimFrame2ID() const { return Resource::HAZARD_BARRACUDA_ANIM2_ID; }
+        virtual const std::string& getAnimFrame1ID() const { return Resource::HAZARD_BARRACUDA_ANIM1_ID; }
+        virtual const std::string& getAnimFrame2ID() const { return Resource::HAZARD_BARRACUDA_ANIM2_ID; }
 };
 
 #endif // HAZARD_HPP
\ No newline at end of file
@@ -16,6 +16,7 @@ class HeavyHazard : public Hazard {
         spriteID = Resource::HAZARD_HEAVY_ID;
     }
     void update() override { Hazard::update(); }
+    FloaterKind getKind() const override { return FloaterKind::HEAVY_HAZARD; }
     float getSlowFactor() const {return slowFactor; }
 
     private:
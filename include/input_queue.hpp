@@ -0,0 +1,51 @@
+// Timestamped player input, handed to the fishing logic one fixed tick at a time
+#ifndef INPUT_QUEUE_HPP
+#define INPUT_QUEUE_HPP
+
+#include <deque> // For pending input
+#include <vector> // For drained actions
+#include <SDL.h> // For Uint32 timestamps and scancodes
+#include "view_adapter.hpp"
+
+/**
+ * @class InputQueue
+ * @brief Holds input stamped with SDL event time until the tick that covers that time runs
+ * @details One-shot actions (release, start) are replayed in order; direction keys are tracked
+ * as held/released from their key events, so a tap shorter than a frame still moves the rod for
+ * the ticks it was down instead of depending on when the keyboard state happened to be sampled.
+ */
+class InputQueue
+{
+    public:
+        void pushAction(Uint32 timestamp, UserInput::Action action);
+        void pushKey(Uint32 timestamp, SDL_Scancode key, bool down);
+        Uint32 drain(Uint32 tickTime, std::vector<UserInput::Action>& actions);
+        UserInput::Action heldDirection() const;
+        void resync(const Uint8* keyState);
+
+    private:
+        /**
+         * @struct TimedInput
+         * @brief An action or a direction key change and when SDL saw it
+         */
+        struct TimedInput
+        {
+            Uint32 timestamp;
+            UserInput::Action action; // NONE for key changes
+            unsigned int keyBit;      // Direction key changed, 0 for actions
+            bool down;
+        };
+
+        // Direction keys as bits of heldKeys
+        static const unsigned int KEY_UP = 1;
+        static const unsigned int KEY_DOWN = 2;
+        static const unsigned int KEY_LEFT = 4;
+        static const unsigned int KEY_RIGHT = 8;
+
+        std::deque<TimedInput> pending;
+        unsigned int heldKeys = 0;
+
+        static unsigned int keyBitFor(SDL_Scancode key);
+};
+
+#endif // INPUT_QUEUE_HPP
@@ -0,0 +1,181 @@
+// Shared worker pool: work-stealing queues, counters to wait on, and a parallel-for helper
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <vector> // For queues and workers
+#include <memory> // For owned queues
+#include <thread> // For workers
+#include <mutex> // For queue and counter locks
+#include <condition_variable> // For idle workers
+#include <atomic> // For counters and the parallel-for cursor
+#include <algorithm> // For parallel-for chunking
+#include "alloc_tracker.hpp"
+
+class JobCounter;
+
+typedef void (*JobFunction)(void* data);
+
+/**
+ * @struct Job
+ * @brief A function and its argument; jobs never own their data, so scheduling one never allocates
+ */
+struct Job
+{
+    JobFunction function;
+    void* data;
+    JobCounter* counter; // Decremented when the job finishes, may be nullptr
+    AllocTracker::Account* account; // Submitting thread, charged for the job's allocations
+};
+
+/**
+ * @class JobCounter
+ * @brief Counts unfinished jobs; wait on it, or queue jobs to start once it reaches zero
+ * @details Must outlive every job counted on it and every job waiting for it.
+ */
+class JobCounter
+{
+    public:
+        JobCounter() : pending(0), continuationCount(0) {}
+        ~JobCounter() { std::lock_guard<std::mutex> lock(mutex); } // Waits out a finish() still holding it
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+        static const int MAX_CONTINUATIONS = 8;
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<int> pending;
+        std::mutex mutex;                       // Held for every decrement so the last one sees all continuations
+        Job continuations[MAX_CONTINUATIONS];   // Jobs submitted with submitAfter() on this counter
+        int continuationCount;
+};
+
+/**
+ * @class JobSystem
+ * @brief Thread pool with one work-stealing queue per thread
+ * @details Each worker pushes and pops its own queue from the back (newest first, while its data
+ * is still in cache) and steals from the front of the others when it runs dry. Threads outside
+ * the pool share one extra queue. wait() never just blocks: the waiting thread runs queued jobs
+ * until the counter reaches zero, so the game thread keeps a core busy instead of idling on a
+ * barrier. Lanes, economy sweeps, floater updates and asset decoding all share shared(), so the
+ * game never runs more workers than there are cores.
+ */
+class JobSystem
+{
+    public:
+        explicit JobSystem(int threads = 0);
+        ~JobSystem();
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        static JobSystem& shared();
+        static bool configureShared(int threads);
+
+        void submit(JobFunction function, void* data, JobCounter* counter = nullptr);
+        void submitAfter(JobCounter& dependency, JobFunction function, void* data, JobCounter* counter = nullptr);
+        void wait(const JobCounter& counter);
+
+        template <typename Body>
+        void parallelFor(int count, int grain, const Body& body, int maxThreads = 0);
+
+        int getWorkerCount() const { return static_cast<int>(workers.size()); }
+
+        static const int QUEUE_CAPACITY = 256;
+
+    private:
+        /**
+         * @class WorkQueue
+         * @brief Fixed ring of jobs; the owner uses the back, thieves the front
+         */
+        class WorkQueue
+        {
+            public:
+                bool push(const Job& job);
+                bool pop(Job& job);
+                bool steal(Job& job);
+
+            private:
+                std::mutex mutex;
+                Job jobs[QUEUE_CAPACITY];
+                size_t front = 0;
+                size_t back = 0;    // front == back: empty
+        };
+
+        std::vector<std::unique_ptr<WorkQueue>> queues; // 0: threads outside the pool, 1..N: workers
+        std::vector<std::thread> workers;
+
+        std::mutex sleepMutex;
+        std::condition_variable wakeUp;
+        std::atomic<int> queuedJobs;
+        std::atomic<int> sleepingWorkers;
+        std::atomic<bool> stopping;
+
+        void enqueue(const Job& job);
+        static void run(const Job& job);
+        bool runOneJob();
+        void finish(const Job& job);
+        int currentQueue() const;
+        void workerLoop(int queue);
+};
+
+/**
+ * @brief Runs body(begin, end) over [0, count) in chunks of grain, on the pool and the calling thread
+ * @param count Number of items
+ * @param grain Items per chunk; chunks are claimed one at a time, so uneven work balances out
+ * @param body Called with each chunk's half-open range, possibly from several threads at once
+ * @param maxThreads Most threads to use including the caller, 0 for the whole pool
+ */
+template <typename Body>
+void JobSystem::parallelFor(int count, int grain, const Body& body, int maxThreads)
+{
+    if (count <= 0) {
+        return;
+    }
+    grain = std::max(1, grain);
+    int chunks = (count + grain - 1) / grain;
+    int helpers = std::min(chunks - 1, getWorkerCount());
+    if (maxThreads > 0) {
+        helpers = std::min(helpers, maxThreads - 1);
+    }
+    if (helpers <= 0) {
+        body(0, count);
+        return;
+    }
+
+    // Lives on this stack frame; wait() below keeps it alive until every helper is done
+    struct Range
+    {
+        const Body* body;
+        int count;
+        int grain;
+        std::atomic<int> next;
+
+        void run()
+        {
+            int begin;
+            while ((begin = next.fetch_add(grain)) < count) {
+                (*body)(begin, std::min(count, begin + grain));
+            }
+        }
+
+        static void job(void* data) { static_cast<Range*>(data)->run(); }
+    };
+
+    Range range;
+    range.body = &body;
+    range.count = count;
+    range.grain = grain;
+    range.next = 0;
+
+    JobCounter counter;
+    for (int i = 0; i < helpers; i++) {
+        submit(&Range::job, &range, &counter);
+    }
+    range.run();
+    wait(counter);
+}
+
+#endif // JOB_SYSTEM_HPP
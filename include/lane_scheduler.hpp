@@ -0,0 +1,58 @@
+// Ticks several fishing rounds side by side on the shared job system
+#ifndef LANE_SCHEDULER_HPP
+#define LANE_SCHEDULER_HPP
+
+#include <vector> // For lanes
+#include <memory> // For shared logic and owned bots
+#include <SDL.h> // For Uint32
+#include "job_system.hpp"
+#include "fishing_logic.hpp"
+#include "fishing_snapshot.hpp"
+#include "bot.hpp"
+#include "view_adapter.hpp"
+
+/**
+ * @class LaneScheduler
+ * @brief Runs N independent FishingLogic instances ("lanes") concurrently, one frame per tick()
+ * @details tick() spreads the lanes over JobSystem::shared() with parallelFor, the calling thread
+ * helps, and it returns only once every lane has updated and published its snapshot. Between ticks no worker
+ * touches a lane, so the caller may set input and query the logic freely; snapshots can be
+ * read at any time through each logic's SnapshotBuffer.
+ */
+class LaneScheduler
+{
+    public:
+        explicit LaneScheduler(int threads = 0);
+        LaneScheduler(const LaneScheduler&) = delete;
+        LaneScheduler& operator=(const LaneScheduler&) = delete;
+
+        int addLane(const std::shared_ptr<FishingLogic>& logic, std::unique_ptr<Bot> bot = nullptr);
+        void setInput(int lane, UserInput::Action action);
+        void tick(Uint32 frameMs = 0);
+
+        size_t getLaneCount() const { return lanes.size(); }
+        const FishingSnapshot& getSnapshot(int lane) { return lanes[lane]->logic->acquireSnapshot(); }
+        FishingLogic& getLogic(int lane) { return *lanes[lane]->logic; }
+        bool allFinished() const;
+
+    private:
+        /**
+         * @struct Lane
+         * @brief One round plus whatever drives it
+         */
+        struct Lane
+        {
+            std::shared_ptr<FishingLogic> logic;
+            std::unique_ptr<Bot> bot; // nullptr: input comes from setInput
+            BotObservation observation;
+            UserInput::Action input = UserInput::Action::NONE;
+        };
+
+        std::vector<std::unique_ptr<Lane>> lanes;
+        int threadLimit;            // Most threads ticking lanes, caller included; 0 = whole pool
+        Uint32 currentFrameMs = 0;
+
+        void tickLane(Lane& lane);
+};
+
+#endif // LANE_SCHEDULER_HPP
@@ -0,0 +1,56 @@
+// Data-driven level spawn configuration
+#ifndef LEVEL_CONFIG_HPP
+#define LEVEL_CONFIG_HPP
+
+#include <string>
+#include <vector>
+#include <istream>
+#include <random> // For variant generation
+
+/**
+ * @struct LevelParams
+ * @brief Spawn counts and hazard speed for a single fishing day
+ */
+struct LevelParams
+{
+    int smallFish = 0;
+    int mediumFish = 0;
+    int bigFish = 0;
+
+    int normalHazards = 0;
+    int heavyHazards = 0;
+    int shockHazards = 0;
+
+    float hazardSpeedMultiplier = 1.0f;
+};
+
+/**
+ * @class LevelTable
+ * @brief Table of per-day level parameters, loaded once at startup
+ * @details Rows are stored in day order starting from day 1.  Days past the end of the
+ * table are extrapolated from the growth between the last two rows and clamped to the
+ * caps in Game::, so tuning never needs a recompile and the campaign has no hard ceiling.
+ */
+class LevelTable
+{
+    public:
+        LevelTable(); // Built-in defaults from the Level:: namespaces
+
+        bool loadFromFile(const std::string& filename);
+        bool parse(std::istream& in);
+
+        LevelParams getLevel(int dayCount) const;
+        void setLevel(int dayCount, const LevelParams& params);
+        int getTableDays() const { return static_cast<int>(days.size()); }
+
+        // Balance sweep helper: jitter every value of a level by up to +/- jitter (0.0 to 1.0)
+        static LevelParams makeVariant(const LevelParams& base, std::mt19937& rng, float jitter);
+
+        // Shared table used by the game; populated by main before any fishing round starts
+        static LevelTable& global();
+
+    private:
+        std::vector<LevelParams> days;
+};
+
+#endif // LEVEL_CONFIG_HPP
@@ -6,10 +6,11 @@ class MediumFish : public Fish {
 public:
     MediumFish(float w, float h, float xSpeed) : Fish(w, h, xSpeed, Resource::FISH_MEDIUM_ID) {}
     void update() override;
+    FloaterKind getKind() const override { return FloaterKind::MEDIUM_FISH; }
     
     // Override animation frame IDs
-    std::string getAnimFrame1ID() const override { return Resource::FISH_MEDIUM_ANIM1_ID; }
-    std::string getAnimFrame2ID() const override { return Resource::FISH_MEDIUM_ANIM2_ID; }
+    const std::string& getAnimFrame1ID() const override { return Resource::FISH_MEDIUM_ANIM1_ID; }
+    const std::string& getAnimFrame2ID() const override { return Resource::FISH_MEDIUM_ANIM2_ID; }
 };
 
 #endif // MEDIUM_FISH_HPP
\ No newline at end of file
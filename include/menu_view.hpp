@@ -21,7 +21,7 @@ public:
     // Core loop methods
     bool isDone() const {return done;}
     void input(SDL_Event &e) override;
-    void render() override;
+    void render(RenderCommandBuffer& commands) override;
 
     void updateResolution() override;
 
@@ -39,7 +39,7 @@ private:
     TextBox largeResButton;
     void handleResolutionChange(int width, int height);
 
-    void renderMenu();
+    void renderMenu(RenderCommandBuffer& commands);
     void mouseClick(float x, float y);
 };
 
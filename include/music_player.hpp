@@ -0,0 +1,107 @@
+// Background music streamed from disk on a decoder thread and crossfaded between game states
+#ifndef MUSIC_PLAYER_HPP
+#define MUSIC_PLAYER_HPP
+
+#include <atomic> // For track requests and deck hand-off
+#include <condition_variable> // For waking the decoder
+#include <cstdint> // For routing serials
+#include <memory> // For the sample rings
+#include <mutex> // For waking the decoder
+#include <thread> // For the decoder thread
+#include <SDL.h>
+#include <SDL_mixer.h>
+#include "spsc_ring.hpp"
+
+enum class MusicTrack {
+    NONE,
+    MENU,
+    STORE,
+    FISHING
+};
+
+/**
+ * @class MusicPlayer
+ * @brief Streams looping WAV tracks through two decks and crossfades when the track changes
+ * @details play() only stores the wanted track and wakes the decoder thread, so a state change
+ * never waits on file I/O. The decoder thread owns the files: it reads each deck's track in
+ * small blocks into that deck's sample ring and seeks back to the start of the data at the end,
+ * so loops are gapless. To change track it opens the file on whichever deck is silent, fills
+ * its ring and then routes playback to it. SDL_mixer's music hook, on the audio thread, mixes
+ * both decks, ramping the routed deck up and the other down over CROSSFADE_MS. Memory is the
+ * two rings and a read block whatever the track length. Tracks must be 16-bit PCM at the
+ * device rate, mono or stereo.
+ */
+class MusicPlayer
+{
+    public:
+        MusicPlayer() = default;
+        ~MusicPlayer();
+        MusicPlayer(const MusicPlayer&) = delete;
+        MusicPlayer& operator=(const MusicPlayer&) = delete;
+
+        bool open();
+        void close();
+        void play(MusicTrack track);
+        uint32_t getUnderrunCount() const { return underruns.load(std::memory_order_relaxed); }
+
+        static const int CROSSFADE_MS = 1000;
+        static const size_t RING_SAMPLES = 65536;  // About 0.75 s of 44.1 kHz stereo per deck
+
+    private:
+        static const int DECKS = 2;
+        static const int READ_SAMPLES = 4096;      // Decoder block
+        static const int MIX_SAMPLES = 2048;       // Audio thread block
+
+        typedef SpscRing<Sint16, RING_SAMPLES> SampleRing;
+
+        /**
+         * @struct Deck
+         * @brief A track being streamed; decoder thread only
+         */
+        struct Deck
+        {
+            MusicTrack track = MusicTrack::NONE;
+            SDL_RWops* file = nullptr;
+            int channels = 0;
+            Sint64 dataStart = 0;
+            Uint32 dataLength = 0;      // Bytes
+            Uint32 dataRead = 0;        // Bytes since dataStart
+        };
+
+        bool opened = false;
+        int frequency = 0;
+        std::unique_ptr<SampleRing> rings[DECKS];   // Decoder thread to audio thread
+
+        // Game thread to decoder thread
+        std::atomic<int> requested{static_cast<int>(MusicTrack::NONE)};
+        std::thread decoder;
+        std::mutex mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+
+        // Decoder thread to audio thread: routed deck (+1, 0 for none) in the low bits, change count above
+        std::atomic<uint32_t> routing{0};
+        std::atomic<uint32_t> routingSeen{0};       // Last routing a finished callback mixed with
+        std::atomic<bool> audible[DECKS] = {};      // Deck routed or still fading out, as of that callback
+        std::atomic<uint32_t> underruns{0};
+
+        // Decoder thread only
+        Deck decks[DECKS];
+        Sint16 readBuffer[READ_SAMPLES];
+
+        // Audio thread only
+        float gains[DECKS] = {};
+        float fadeStep = 0.0f;
+        Sint16 mixBuffer[MIX_SAMPLES];
+
+        static void hook(void* player, Uint8* stream, int length);
+        void mix(Sint16* out, int samples);
+        void decodeLoop();
+        void route(int deck);
+        bool isFree(int deck) const;
+        bool openTrack(Deck& deck, MusicTrack track);
+        void closeTrack(Deck& deck);
+        bool fill(int deck);
+};
+
+#endif // MUSIC_PLAYER_HPP
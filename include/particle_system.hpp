@@ -0,0 +1,61 @@
+// Fixed-capacity particle pool for splashes, bubbles and sparks
+#ifndef PARTICLE_SYSTEM_HPP
+#define PARTICLE_SYSTEM_HPP
+
+#include <cstdint> // For the random state
+#include <vector> // For structure-of-arrays buffers
+#include <SDL.h> // For SDL_Color
+#include "render_commands.hpp"
+#include "Vector2D.hpp"
+
+/**
+ * @struct ParticleEmitter
+ * @brief How one burst of particles looks and moves; speeds and sizes are scaled by emit()
+ */
+struct ParticleEmitter
+{
+    int count;
+    float minSpeed, maxSpeed;   // Per tick
+    float angle, spread;        // Launch direction and half the cone around it, radians (0 = right, up is negative)
+    float minLife, maxLife;     // Ticks
+    float minSize, maxSize;     // Square side
+    float gravity;              // Per tick squared; negative rises
+    float drag;                 // Velocity kept per tick
+    SDL_Color color;
+};
+
+/**
+ * @class ParticleSystem
+ * @brief Steps and draws every live particle of a view
+ * @details Particles live in structure-of-arrays buffers sized once, so emitting never allocates
+ * and bursts past the capacity are cut short instead. Live particles are packed at the front:
+ * step() moves and fades them in one straight-line loop the compiler vectorizes, then packs
+ * the survivors down in a second pass. draw() records them all as one geometry batch.
+ */
+class ParticleSystem
+{
+    public:
+        explicit ParticleSystem(int capacity);
+
+        int emit(const ParticleEmitter& emitter, const Vector2D& position, float scale = 1.0f);
+        void step();
+        void draw(RenderCommandBuffer& commands) const;
+        void clear() { live = 0; }
+
+        int getLiveCount() const { return live; }
+        int getCapacity() const { return capacity; }
+
+    private:
+        int capacity;
+        int live = 0;
+        std::vector<float> posX, posY, velX, velY;
+        std::vector<float> gravity, drag;
+        std::vector<float> alpha, fade;     // Alpha left and lost per tick; dead at zero
+        std::vector<float> halfSize;
+        std::vector<SDL_Color> color;       // Alpha follows alpha[] each step
+        uint32_t randomState = 0x9E3779B9u;
+
+        float random(float low, float high);
+};
+
+#endif // PARTICLE_SYSTEM_HPP
@@ -14,7 +14,7 @@ public:
     ~PauseMenu() = default;
     
     // Core methods
-    void render();
+    void render(RenderCommandBuffer& commands);
     bool handleEvent(SDL_Event& e);
     
     // Set the fishing logic pointer to control pause state
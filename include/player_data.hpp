@@ -5,6 +5,18 @@
 #include <fstream>
 #include "game_constants.hpp"
 
+/**
+ * @struct DaySettlement
+ * @brief Earnings breakdown for one fishing day, shown in the results popup
+ */
+struct DaySettlement {
+    int catchScore = 0;
+    int gross = 0;
+    int rentPaid = 0;
+    int profit = 0;
+    float multiplier = 1.0f;
+};
+
 class PlayerData {
 public:
     PlayerData();
@@ -51,6 +63,10 @@ public:
     void upgradeClock() { clockLevel++; }
     void upgradeRegister() { registerLevel++; }
     void upgradeLedger() { ledgerLevel++; ledgerIncome += Game::LEDGER_INCOME;}
+
+    // End-of-day economy, shared by the game and the economy simulator
+    DaySettlement settleDay(int catchScore);
+    void advanceDay();
     
     // Game stats
     int getTotalFishCaught() const { return totalFishCaught; }
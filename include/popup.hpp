@@ -5,6 +5,7 @@
 #include <SDL_ttf.h>
 #include <string>
 #include <vector>
+#include "render_commands.hpp"
 
 class Popup {
 public:
@@ -17,7 +18,7 @@ public:
     // Handle events for closing the popup
     bool handleEvent(SDL_Event& e);
 
-    void render();
+    void render(RenderCommandBuffer& commands);
     bool isVisible() const { return visible; }
     void updateScreenDimensions(int newWidth, int newHeight);
     void updateRenderer(SDL_Renderer* newRenderer) { renderer = newRenderer; }
@@ -11,6 +11,19 @@
 #include "view_adapter.hpp"
 #include "player_data.hpp"
 #include "popup.hpp"
+#include "bot.hpp"
+#include "world_metrics.hpp"
+#include "lane_scheduler.hpp"
+#include "render_commands.hpp"
+#include "render_thread.hpp"
+#include "input_queue.hpp"
+#include "frame_telemetry.hpp"
+#include "frame_pacer.hpp"
+#include "alloc_tracker.hpp"
+#include "frame_arena.hpp"
+#include "audio_engine.hpp"
+#include "music_player.hpp"
+#include "resolution_scaler.hpp"
 #include <iostream>
 #include <fstream> // For victory mode ez flag
 #include <SDL.h>
@@ -29,19 +42,33 @@ enum class GameState {
 
 class ProcessManager {
 public:
-    ProcessManager();
+    // useRenderThread: replay and present on a render thread; targetFps 0 follows the display
+    explicit ProcessManager(bool useRenderThread = false, PacingMode pacing = PacingMode::AUTO, int targetFps = 0);
     ~ProcessManager();
     void run();
+    void setBot(std::unique_ptr<Bot> newBot); // Bot plays fishing rounds instead of the keyboard
+    void setLaneCount(int count); // Bot-played rival ponds fished alongside the player's
+    void setLatencyReport(bool enabled); // Print frame time and input-to-photon latency on exit
+    void setAllocReport(bool enabled); // Count heap allocations per frame and zone, print on exit
+    void setRenderScaleBounds(float minScale, float maxScale); // Fishing scene resolution range, 1 = the window's
 
 private:
     // Moved window creation to here
     SDL_Window* window;
     SDL_Renderer* renderer;
-    void initializeSDL();
+    void initializeSDL(bool useRenderThread);
+    SDL_Renderer* createRenderer();
+    void releaseRenderer();
+
+    // Views record into a frame; it is replayed here or on the render thread
+    std::unique_ptr<RenderThread> renderThread;
+    RenderCommandBuffer frameCommands;
+    FramePacer framePacer;
 
     // Game state management
     GameState currentState;
     bool isRunning;
+    WorldMetrics screenMetrics; // Scaled sizes for the window; fishing logic runs in WorldMetrics::world()
 
     // Game modules
     const std::shared_ptr<GameNotifier> gameNotifier = make_shared<GameNotifier>();
@@ -59,6 +86,26 @@ private:
     void handleNotification(const std::string& notification);
     void updateCurrentModule();
     void renderCurrentModule();
+    bool drawScene(RenderCommandBuffer& commands, bool scaled = false);
+    SDL_Texture* createSceneTexture();
+
+    // Freeze frame: the scene under the pause menu or a popup, captured once and reused
+    SDL_Texture* frozenScene = nullptr;
+    bool sceneFrozen = false;       // frozenScene holds frozenState's scene
+    GameState frozenState = GameState::MENU;
+    bool freezeUnsupported = false; // No render targets; paused scenes are redrawn
+    bool freezeScene(RenderCommandBuffer& commands);
+
+    // Dynamic resolution: the fishing scene is drawn into the corner of sceneTarget and upscaled
+    ResolutionScaler renderScaler;
+    SDL_Texture* sceneTarget = nullptr;
+    bool scalingUnsupported = false; // No render targets; the scene is drawn at full size
+    double lastReplayMs = 0.0;      // Replays on this thread (no render thread)
+    uint32_t replayedFrames = 0;
+    uint32_t sampledFrames = 0;     // Replays already given to renderScaler
+    SDL_Texture* scaledSceneTarget();
+    void sampleRenderTime();
+
     int calculateFishingLevel();
 
     // Player data management
@@ -72,15 +119,47 @@ private:
     const std::string SAVE_FILE_PATH = "fishing_game_save.txt";
 
     // Move to game constants
-    const int TARGET_FPS = 60;
-    const int FRAME_DELAY = 1000 / TARGET_FPS;
-    Uint32 frameStart;
-    int frameTime;
+    const int TICK_RATE = 60;
+    const int FRAME_DELAY = 1000 / TICK_RATE; // Fishing tick length; frame rate is up to framePacer
+    const int MAX_CATCHUP_TICKS = 5; // Ticks run in one frame before dropping time
+
+    // Fixed-timestep fishing: input is queued with event timestamps and applied by the tick covering it
+    InputQueue inputQueue;
+    std::vector<UserInput::Action> tickActions; // Reused per tick
+    Uint32 nextTickTime = 0;
+    Uint32 unrenderedInputTime = 0; // Oldest applied input not yet in a recorded frame
+    void startFishingClock();
+    void runFishingTick(Uint32 tickTime);
+
+    // Sound effects for the player's round; silent if there is no audio device
+    AudioEngine audio;
+    uint32_t playedEvents = 0; // Fishing events already sent to audio
+    void playFishingEvents();
+
+    // Per-state background music, crossfaded on state changes
+    MusicPlayer music;
+    void playStateMusic();
+
+    // Optional --latency telemetry
+    bool latencyReport = false;
+    FrameTelemetry telemetry;
+    bool allocReport = false;
+    void framePresented(const RenderCommandBuffer& frame);
 
     std::string lastNote; // previous notification
 
     UserInput::Action userInput;
 
+    // Optional autoplayer for fishing rounds
+    std::unique_ptr<Bot> bot;
+    BotObservation botObservation;
+
+    // Optional rival lanes; lane 0 is the player's round
+    int laneCount = 1;
+    std::unique_ptr<LaneScheduler> laneScheduler;
+    void createRivalLanes(int level, int roundDuration);
+    void drawRivalLanes(RenderCommandBuffer& commands);
+
     void logSDLError(const std::string& message);
 
     void changeResolution(int width, int height);
@@ -0,0 +1,124 @@
+// Per-frame list of draw calls, recorded by the views and replayed against an SDL_Renderer
+#ifndef RENDER_COMMANDS_HPP
+#define RENDER_COMMANDS_HPP
+
+#include <string> // For packed text runs
+#include <vector> // For the command list
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include "Vector2D.hpp" // For line strip points
+
+// Where a text run sits inside its area
+enum class TextAlign {
+    LEFT,       // Top left corner of the area
+    CENTER,     // Centered both ways
+    CENTER_X    // Centered horizontally, top of the area
+};
+
+enum class RenderCommandType {
+    CLEAR,
+    SPRITE,
+    ROTATED_SPRITE,
+    FILL_RECT,
+    OUTLINE_RECT,
+    TEXT,
+    ELLIPSE,
+    THICK_LINE,
+    GEOMETRY,
+    UPDATE_TEXTURE,
+    CLIP,
+    TARGET
+};
+
+/**
+ * @struct RenderCommand
+ * @brief One recorded draw call; plain values only so a frame can be replayed on another thread
+ */
+struct RenderCommand
+{
+    RenderCommandType type;
+    SDL_Rect rect;              // Destination/area; ellipse: center and radii; line: both end points; update: pixel size
+    SDL_Rect source;            // Sprites: texture region, empty for the whole texture
+    SDL_Color color;
+    SDL_Texture* texture;       // Sprites; target: null for the window
+    TTF_Font* font;             // Text
+    double angle;               // Rotated sprites, degrees
+    SDL_RendererFlip flip;
+    int size;                   // Font point size, line width or geometry index count; clip: 0 turns clipping off
+    size_t textOffset;          // Start of the text run, geometry indices or texture pixels in their storage
+    TextAlign align;
+};
+
+/**
+ * @class RenderCommandBuffer
+ * @brief Records a frame of sprites, rects, text runs and primitives for a later replay()
+ * @details setTransform() scales and offsets everything recorded after it, so world-space
+ * views can draw into any part of the window without changing the renderer's own scale
+ * (which SDL also applies to mouse events). reset() keeps the capacity from earlier frames.
+ */
+class RenderCommandBuffer
+{
+    public:
+        RenderCommandBuffer();
+        void reset();
+
+        void clear(const SDL_Color& color);
+        void sprite(SDL_Texture* texture, const SDL_Rect& dst, SDL_RendererFlip flip = SDL_FLIP_NONE);
+        void spriteRegion(SDL_Texture* texture, const SDL_Rect& source, const SDL_Rect& dst);
+        void rotatedSprite(SDL_Texture* texture, const SDL_Rect& dst, double angle, SDL_RendererFlip flip = SDL_FLIP_NONE);
+        void fillRect(const SDL_Rect& rect, const SDL_Color& color);
+        void outlineRect(const SDL_Rect& rect, const SDL_Color& color);
+        void text(TTF_Font* font, int pointSize, const std::string& str, const SDL_Rect& area,
+            const SDL_Color& color, TextAlign align = TextAlign::LEFT);
+        void text(TTF_Font* font, int pointSize, const char* str, const SDL_Rect& area,
+            const SDL_Color& color, TextAlign align = TextAlign::LEFT);
+        void ellipse(int x, int y, int rx, int ry, const SDL_Color& color);
+        void thickLine(int x1, int y1, int x2, int y2, int width, const SDL_Color& color);
+        void lineStrip(const Vector2D* points, int count, float width, const SDL_Color& color);
+        void squares(const float* centerX, const float* centerY, const float* halfSize, const SDL_Color* colors, int count);
+        void updateTexture(SDL_Texture* texture, const Uint32* pixels, int width, int height);
+        void setClip(const SDL_Rect* clip);
+        void setTarget(SDL_Texture* texture);
+
+        void setTransform(float scaleX, float scaleY, int offsetX = 0, int offsetY = 0);
+        void resetTransform() { setTransform(1.0f, 1.0f); }
+
+        void replay(SDL_Renderer* renderer) const;
+        double replayTimed(SDL_Renderer* renderer) const;
+        size_t size() const { return commands.size(); }
+
+        // Oldest input shown for the first time in this frame, for latency telemetry (0 if none)
+        void setInputTimestamp(Uint32 timestamp) { inputTimestamp = timestamp; }
+        Uint32 getInputTimestamp() const { return inputTimestamp; }
+
+    private:
+        // Starting capacity, above a busy fishing frame so play doesn't grow the buffer
+        static const size_t INITIAL_COMMANDS = 512;
+        static const size_t INITIAL_TEXT = 1024;
+        static const size_t INITIAL_VERTICES = 256; // A few fishing lines
+        static const size_t INITIAL_INDICES = 768;
+        static const size_t INITIAL_PIXELS = 32768; // A water strip at the largest resolution
+
+        std::vector<RenderCommand> commands;
+        std::string textStorage; // Every text run, each '\0' terminated
+        std::vector<Uint32> pixelStorage; // Every texture update, rows packed
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        std::vector<SDL_Vertex> vertexStorage; // Every geometry batch, in window pixels
+        std::vector<int> indexStorage;
+#endif
+        Uint32 inputTimestamp = 0;
+
+        float scaleX = 1.0f;
+        float scaleY = 1.0f;
+        int offsetX = 0;
+        int offsetY = 0;
+
+        RenderCommand& push(RenderCommandType type, const SDL_Color& color);
+        SDL_Rect transform(const SDL_Rect& rect) const;
+        int transformX(int x) const;
+        int transformY(int y) const;
+        void replayText(SDL_Renderer* renderer, const RenderCommand& command) const;
+        void replayTextureUpdate(const RenderCommand& command) const;
+};
+
+#endif // RENDER_COMMANDS_HPP
@@ -0,0 +1,75 @@
+// Thread that owns the SDL_Renderer and replays recorded frames
+#ifndef RENDER_THREAD_HPP
+#define RENDER_THREAD_HPP
+
+#include <atomic> // For the active instance and replay timings
+#include <deque> // For queued renderer tasks
+#include <exception> // For forwarding renderer creation errors
+#include <stdexcept> // For renderer creation failure
+#include <functional> // For renderer factory and tasks
+#include <thread> // For the render thread
+#include <mutex> // For frame hand-off
+#include <condition_variable> // For frame hand-off
+#include <SDL.h>
+#include "render_commands.hpp"
+
+/**
+ * @class RenderThread
+ * @brief Creates the renderer on its own thread, then replays and presents submitted frames there
+ * @details The game thread records into beginFrame() and hands it over with submitFrame(); two
+ * buffers alternate, so recording the next frame overlaps replaying and presenting (and any vsync
+ * wait) of the last one. beginFrame() only blocks when the render thread is a whole frame behind.
+ * Anything else that must touch the renderer or fonts (creating/destroying textures, opening and
+ * closing fonts) goes through invoke()/runOnRenderer(), which runs after every frame already
+ * submitted, so a texture is never destroyed under a frame that still draws it.
+ */
+class RenderThread
+{
+    public:
+        explicit RenderThread(const std::function<SDL_Renderer*()>& createRenderer);
+        ~RenderThread();
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        SDL_Renderer* getRenderer() const { return renderer; }
+
+        RenderCommandBuffer& beginFrame();
+        void submitFrame();
+        void invoke(const std::function<void()>& task);
+        void setPresentListener(const std::function<void(const RenderCommandBuffer&)>& listener);
+
+        static void runOnRenderer(const std::function<void()>& task);
+
+        // Replay time of the latest presented frame (see RenderCommandBuffer::replayTimed)
+        double getLastReplayMs() const { return lastReplayMs.load(std::memory_order_relaxed); }
+        uint32_t getReplayedFrames() const { return replayedFrames.load(std::memory_order_acquire); }
+
+    private:
+        enum class FrameState { FREE, PENDING, REPLAYING };
+
+        static std::atomic<RenderThread*> active; // Instance runOnRenderer() sends tasks to
+
+        SDL_Renderer* renderer = nullptr;
+        std::thread thread;
+        std::exception_ptr creationError;
+
+        std::mutex mutex;
+        std::condition_variable wake;       // Render thread: frame or task queued, or stopping
+        std::condition_variable progress;   // Game thread: renderer ready, frame freed or task done
+        RenderCommandBuffer frames[2];
+        FrameState states[2] = {FrameState::FREE, FrameState::FREE};
+        int recordIndex = 0;                // Game thread's buffer
+        int replayIndex = 0;                // Next buffer the render thread replays
+        std::function<void(const RenderCommandBuffer&)> presentListener;
+        std::deque<std::function<void()>> tasks;
+        unsigned long long tasksQueued = 0;
+        unsigned long long tasksDone = 0;
+        bool ready = false;
+        bool stopping = false;
+        std::atomic<double> lastReplayMs{0.0};
+        std::atomic<uint32_t> replayedFrames{0};
+
+        void threadLoop(std::function<SDL_Renderer*()> createRenderer);
+};
+
+#endif // RENDER_THREAD_HPP
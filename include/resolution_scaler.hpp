@@ -0,0 +1,46 @@
+// Picks the fishing scene's render scale from measured frame render times
+#ifndef RESOLUTION_SCALER_HPP
+#define RESOLUTION_SCALER_HPP
+
+#include "game_constants.hpp" // For scale bounds
+
+/**
+ * @class ResolutionScaler
+ * @brief Lowers the scene's render scale as soon as rendering runs over budget and raises it back slowly
+ * @details Each decision averages the last WINDOW render times, taking the cost to follow the
+ * pixel count (the square of the scale). Over budget, the scale jumps straight to the size
+ * expected to fit with some headroom; the window then refills at the new scale, so a first
+ * guess that was not small enough is corrected WINDOW frames later. When one step up would
+ * still leave that headroom, it grows a step after GROW_DELAY such frames in a row, so it
+ * does not bounce between two sizes. Scales are whole multiples of Visuals::RENDER_SCALE_STEP
+ * within the bounds.
+ */
+class ResolutionScaler
+{
+    public:
+        explicit ResolutionScaler(float minScale = Visuals::MIN_RENDER_SCALE, float maxScale = Visuals::MAX_RENDER_SCALE);
+
+        void setBounds(float minScale, float maxScale);
+        void setBudget(double budgetMs) { this->budgetMs = budgetMs; }
+        bool addSample(double renderMs);
+
+        float getScale() const { return scale; }
+        double getBudget() const { return budgetMs; }
+
+        static const int WINDOW = 3;        // Frames averaged per decision
+        static const int GROW_DELAY = 30;   // Calm frames before each step up
+
+    private:
+        float minScale;
+        float maxScale;
+        float scale;
+        double budgetMs = 1000.0 / 60.0 * Visuals::RENDER_BUDGET_SHARE;
+
+        double samples[WINDOW] = {};
+        int sampleCount = 0;    // Since the last change
+        int calmFrames = 0;
+
+        float quantize(float value) const;
+};
+
+#endif // RESOLUTION_SCALER_HPP
@@ -3,6 +3,7 @@
 #include "view_adapter.hpp"
 #include "game_constants.hpp"
 #include "Vector2D.hpp"
+#include "world_metrics.hpp"
 
 class Rod 
 {
@@ -14,21 +15,23 @@ class Rod
         Vector2D dimens;
         float velocity;
         const float maxVelocity;
+        float minY; // Travel limits from the world metrics
+        float maxY;
 
     public: 
-        Rod(float speedMultipier); // default
-        Vector2D getPosition() { return position; }
+        Rod(float speedMultiplier, const WorldMetrics& metrics);
+        Vector2D getPosition() const { return position; }
         void setPosition(const Vector2D& newPos) { position = newPos; }
-        void setPosition(float x, float y) { position[0] = x; position[1] = y; }
-        Vector2D getDirection() { return direction; }
+        void setPosition(float x, float y) { position = Vector2D(x, y); }
+        Vector2D getDirection() const { return direction; }
         void setDirection(const Vector2D& newPos) { direction = newPos; }
-        void setDirection(float x, float y) { direction[0] = x; direction[1] = y; }
-        Vector2D getSpeed() { return speed; }
+        void setDirection(float x, float y) { direction = Vector2D(x, y); }
+        Vector2D getSpeed() const { return speed; }
         void setSpeed(const Vector2D& newPos) { speed = newPos; }
-        void setSpeed(float x, float y) { speed[0] = x; speed[1] = y; }
-        Vector2D getDimens() { return dimens; }
+        void setSpeed(float x, float y) { speed = Vector2D(x, y); }
+        Vector2D getDimens() const { return dimens; }
         void setDimens(const Vector2D& newPos) { dimens = newPos; }
-        void setDimens(float x, float y) { dimens[0] = x; dimens[1] = y; }
+        void setDimens(float x, float y) { dimens = Vector2D(x, y); }
         
         void castUp();
         void castDown();        
@@ -15,6 +15,7 @@ public:
     }
 
     void update() override { Hazard::update(); }
+    FloaterKind getKind() const override { return FloaterKind::SHOCK_HAZARD; }
 };
 
 #endif // SHOCK_HAZARD_HPP
\ No newline at end of file
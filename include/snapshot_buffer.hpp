@@ -0,0 +1,75 @@
+// Lock-free hand-off of fishing snapshots from the logic to a renderer
+#ifndef SNAPSHOT_BUFFER_HPP
+#define SNAPSHOT_BUFFER_HPP
+
+#include <atomic> // For the shared middle slot
+#include <cstdint> // For slot bits
+#include "fishing_snapshot.hpp"
+
+/**
+ * @class SnapshotBuffer
+ * @brief Triple buffer of FishingSnapshot for one writer thread and one reader thread
+ * @details The writer fills beginWrite() and publish()es it; the reader's acquire() returns the
+ * newest published snapshot and keeps it stable until the next acquire(). Neither side ever
+ * waits on the other: they only swap slot indices through one atomic byte.
+ */
+class SnapshotBuffer
+{
+    public:
+        SnapshotBuffer() : middle(1) {}
+        SnapshotBuffer(const SnapshotBuffer&) = delete;
+        SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+        /**
+         * @brief Sizes every slot's floater lists up front so later writes never reallocate
+         * @details Call before the reader starts; touches slots the reader may own afterwards
+         * @param fishCount Most fish a snapshot can hold
+         * @param hazardCount Most hazards a snapshot can hold
+         */
+        void reserve(size_t fishCount, size_t hazardCount)
+        {
+            for (FishingSnapshot& slot : slots) {
+                slot.fish.reserve(fishCount);
+                slot.hazards.reserve(hazardCount);
+            }
+        }
+
+        /**
+         * @brief Slot the writer may fill; not visible to the reader until publish()
+         * @return FishingSnapshot& back buffer
+         */
+        FishingSnapshot& beginWrite() { return slots[writeSlot]; }
+
+        /**
+         * @brief Makes the back buffer the newest snapshot and takes the old middle slot to write next
+         */
+        void publish()
+        {
+            uint8_t previous = middle.exchange(static_cast<uint8_t>(writeSlot | FRESH), std::memory_order_acq_rel);
+            writeSlot = previous & SLOT_MASK;
+        }
+
+        /**
+         * @brief Newest published snapshot; stays valid and unchanged until the next acquire()
+         * @return const FishingSnapshot& front buffer
+         */
+        const FishingSnapshot& acquire()
+        {
+            if (middle.load(std::memory_order_acquire) & FRESH) {
+                uint8_t previous = middle.exchange(readSlot, std::memory_order_acq_rel);
+                readSlot = previous & SLOT_MASK;
+            }
+            return slots[readSlot];
+        }
+
+    private:
+        static const uint8_t SLOT_MASK = 0x3;
+        static const uint8_t FRESH = 0x4; // Middle slot holds a snapshot the reader hasn't taken
+
+        FishingSnapshot slots[3];
+        uint8_t writeSlot = 0;          // Writer thread only
+        uint8_t readSlot = 2;           // Reader thread only
+        std::atomic<uint8_t> middle;    // Slot index plus FRESH bit
+};
+
+#endif // SNAPSHOT_BUFFER_HPP
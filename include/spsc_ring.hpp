@@ -0,0 +1,110 @@
+// Fixed-size lock-free queue between exactly one producer thread and one consumer thread
+#ifndef SPSC_RING_HPP
+#define SPSC_RING_HPP
+
+#include <algorithm> // For bulk copy lengths
+#include <atomic> // For the cursors
+#include <cstddef> // For size_t
+
+/**
+ * @class SpscRing
+ * @brief Single-producer single-consumer ring of plain values
+ * @details push() only writes the tail and pop() only writes the head, each published with
+ * release and read with acquire, so neither side ever locks, waits or allocates. A full ring
+ * refuses the push. Capacity must be a power of two.
+ */
+template <typename T, size_t CAPACITY>
+class SpscRing
+{
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "SpscRing capacity must be a power of two");
+
+    public:
+        SpscRing() : head(0), tail(0) {}
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        /**
+         * @brief Producer thread only
+         * @return bool false if the ring was full and the value was dropped
+         */
+        bool push(const T& value)
+        {
+            size_t at = tail.load(std::memory_order_relaxed);
+            if (at - head.load(std::memory_order_acquire) == CAPACITY) {
+                return false;
+            }
+            items[at & (CAPACITY - 1)] = value;
+            tail.store(at + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Consumer thread only
+         * @return bool false if the ring was empty
+         */
+        bool pop(T& value)
+        {
+            size_t at = head.load(std::memory_order_relaxed);
+            if (at == tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+            value = items[at & (CAPACITY - 1)];
+            head.store(at + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Producer thread only; copies in as many values as there is room for
+         * @return size_t values copied
+         */
+        size_t pushSome(const T* values, size_t count)
+        {
+            size_t at = tail.load(std::memory_order_relaxed);
+            count = std::min(count, CAPACITY - (at - head.load(std::memory_order_acquire)));
+            for (size_t i = 0; i < count; i++) {
+                items[(at + i) & (CAPACITY - 1)] = values[i];
+            }
+            tail.store(at + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * @brief Consumer thread only; copies out as many values as are queued, up to count
+         * @return size_t values copied
+         */
+        size_t popSome(T* values, size_t count)
+        {
+            size_t at = head.load(std::memory_order_relaxed);
+            count = std::min(count, tail.load(std::memory_order_acquire) - at);
+            for (size_t i = 0; i < count; i++) {
+                values[i] = items[(at + i) & (CAPACITY - 1)];
+            }
+            head.store(at + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * @brief Producer thread only
+         * @return size_t values push() could still take
+         */
+        size_t getFree() const
+        {
+            return CAPACITY - (tail.load(std::memory_order_relaxed) - head.load(std::memory_order_acquire));
+        }
+
+        /**
+         * @brief Empties the ring; only while the other thread is known not to be using it
+         */
+        void clear()
+        {
+            head.store(0, std::memory_order_relaxed);
+            tail.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        T items[CAPACITY];
+        alignas(64) std::atomic<size_t> head; // Next to pop; cursors on their own cache lines
+        alignas(64) std::atomic<size_t> tail; // Next to fill
+};
+
+#endif // SPSC_RING_HPP
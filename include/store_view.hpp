@@ -25,7 +25,7 @@ public:
 
     // Core loop methods
     void input(SDL_Event &e) override;
-    void render() override;
+    void render(RenderCommandBuffer& commands) override;
     
     void updateResolution() override;
 
@@ -50,8 +50,8 @@ private:
     TextBox exitButton;
     TextBox resetTutorial;
 
-    void renderStore();
-    void drawPlayerStats(); // draw player stats in a box
+    void renderStore(RenderCommandBuffer& commands);
+    void drawPlayerStats(RenderCommandBuffer& commands); // draw player stats in a box
     void renderBox(const TextBox& box);
     void mouseClick(float x, float y);
 
@@ -6,6 +6,7 @@
 #include <SDL_ttf.h>
 #include "game_constants.hpp"
 #include "scaling.hpp"
+#include "render_commands.hpp"
 
 class TextBox {
     public:
@@ -20,7 +21,9 @@ class TextBox {
               text(text), cost(cost),
               showHoverBox(false), hovered(false), 
               hoverBoxWidth(180), hoverBoxHeight(75),
-              font(font), hoverFont(hoverFont) {
+              font(font), hoverFont(hoverFont),
+              fontSize(Scale::scaleFontSize(Visuals::FONT_SIZE)),
+              hoverFontSize(Scale::scaleFontSize(Visuals::HOVER_FONT_SIZE)) {
             updateScreenPosition();
         }
 
@@ -67,9 +70,15 @@ class TextBox {
             font = newFont;
             hoverFont = newHoverFont;
         }
+
+        // Point sizes the text is drawn at; fonts are shared, so sizes travel with each draw
+        void setFontSizes(int newFontSize, int newHoverFontSize) {
+            fontSize = newFontSize;
+            hoverFontSize = newHoverFontSize;
+        }
         
-        // Render method takes renderer and color
-        void renderBox(SDL_Renderer* renderer, const SDL_Color& color);
+        // Records the box into a frame's commands
+        void renderBox(RenderCommandBuffer& commands, const SDL_Color& color);
 
     
     private:
@@ -94,12 +103,8 @@ class TextBox {
 
         TTF_Font* font;
         TTF_Font* hoverFont;
-        
-        // Helper methods for writing text
-        void writeText(SDL_Renderer* renderer, const std::string& text, int x, int y, const SDL_Color& color);
-        void writeHoverText(SDL_Renderer* renderer, const std::string& text, int x, int y, const SDL_Color& color);
-        void writeTextBlended(SDL_Renderer* renderer, const std::string& text, int x, int y, const SDL_Color& color);
-        void writeHoverTextBlended(SDL_Renderer* renderer, const std::string& text, int x, int y, const SDL_Color& color);
+        int fontSize;
+        int hoverFontSize;
 };
 
 #endif
\ No newline at end of file
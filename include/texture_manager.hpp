@@ -4,44 +4,73 @@
 #include <SDL.h>
 #include <SDL_image.h>
 #include <string>
-#include <map>
+#include <vector> // For id-indexed textures and animations
 #include <iostream>
 #include <unordered_map>
+#include "render_commands.hpp"
+
+// Index of a loaded texture, resolved from its name once at load time
+typedef int SpriteId;
+// Index of a two-frame animation registered with addAnimation()
+typedef int AnimationId;
+
+const SpriteId NO_SPRITE = -1;
+const AnimationId NO_ANIMATION = -1;
+
+// A texture name and the image file to load it from
+struct TextureFile {
+    std::string id;
+    std::string filePath;
+};
 
 class TextureManager {
     private:
-        std::map<std::string, SDL_Texture*> textureMap;
+        std::vector<SDL_Texture*> textures; // Indexed by SpriteId
+        std::unordered_map<std::string, SpriteId> spriteIds; // Name lookup, load time only
         SDL_Renderer* renderer;
 
-        // Animation tracking
-        std::unordered_map<std::string, bool> animationFrameState; // true = frame1, false = frame2
-        std::unordered_map<std::string, Uint32> lastAnimationTime;
-        std::unordered_map<std::string, int> animationDelays;
+        /**
+         * @struct Animation
+         * @brief Two frames swapped every delay ms; floaters of a kind share one so they swim in step
+         */
+        struct Animation {
+            SpriteId frame1;
+            SpriteId frame2;
+            int delay;
+            Uint32 lastSwitch;
+            bool started;
+            bool onFrame1;
+        };
+        std::vector<Animation> animations; // Indexed by AnimationId
+
+        SDL_Texture* textureFor(SpriteId id) const;
+        bool addTexture(const std::string& id, const std::string& filePath, SDL_Surface* surface);
 
     public:
         TextureManager(SDL_Renderer* renderer);
         ~TextureManager();
 
         bool loadTexture(const std::string& id, const std::string& filePath);
-        void drawTexture(const std::string& id, int x, int y, int scaledW, int scaledH, SDL_RendererFlip flip = SDL_FLIP_NONE);
-        void drawRotatedTexture(const std::string& id, int x, int y, int scaledW, int scaledH, 
+        bool loadTextures(const std::vector<TextureFile>& files);
+        SpriteId getSpriteId(const std::string& id) const;
+        AnimationId addAnimation(const std::string& frame1Id, const std::string& frame2Id, int delay);
+
+        void drawTexture(RenderCommandBuffer& commands, SpriteId id, int x, int y, int scaledW, int scaledH, SDL_RendererFlip flip = SDL_FLIP_NONE);
+        void drawRotatedTexture(RenderCommandBuffer& commands, SpriteId id, int x, int y, int scaledW, int scaledH,
             double angle, SDL_RendererFlip flip = SDL_FLIP_NONE);
-        
+
         // Animation methods
-        void drawAnimatedTexture(const std::string& baseId, const std::string& anim1Id, 
-            const std::string& anim2Id, int x, int y, int scaledW, int scaledH, 
-            int delay, SDL_RendererFlip flip = SDL_FLIP_NONE);
-        
-        void drawAnimatedRotatedTexture(const std::string& baseId, const std::string& anim1Id, 
-            const std::string& anim2Id, int x, int y, int scaledW, int scaledH, 
-            double angle, int delay, SDL_RendererFlip flip = SDL_FLIP_NONE);
-        
-        // Get current animation frame ID based on time and delay
-        std::string getCurrentAnimationFrame(const std::string& baseId, 
-            const std::string& anim1Id, const std::string& anim2Id, int delay);
-        
+        void drawAnimatedTexture(RenderCommandBuffer& commands, AnimationId animation, int x, int y, int scaledW, int scaledH,
+            SDL_RendererFlip flip = SDL_FLIP_NONE);
+
+        void drawAnimatedRotatedTexture(RenderCommandBuffer& commands, AnimationId animation, int x, int y, int scaledW, int scaledH,
+            double angle, SDL_RendererFlip flip = SDL_FLIP_NONE);
+
+        // Get current animation frame based on time and the animation's delay
+        SpriteId getCurrentAnimationFrame(AnimationId animation);
+
         void clearTextures();
         void updateRenderer(SDL_Renderer* newRenderer);
 };
 
-#endif
\ No newline at end of file
+#endif
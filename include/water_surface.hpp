@@ -0,0 +1,49 @@
+// Ripples along the pond's waterline, simulated as a 1D height field
+#ifndef WATER_SURFACE_HPP
+#define WATER_SURFACE_HPP
+
+#include <cstdint> // For pixels
+#include <vector> // For heights and the pixel strip
+#include "world_metrics.hpp"
+
+/**
+ * @class WaterSurface
+ * @brief Damped 1D wave equation across the pond, rasterized into a thin strip of ARGB pixels
+ * @details One column per few window pixels, with a fixed zero column past each end. Each
+ * step computes every column from its neighbours and its previous height four columns at a
+ * time (SSE2, or scalar code in the same order elsewhere) and swaps the two height buffers.
+ * rasterize() redraws the strip centred on the waterline: clear above the wave, a foam line
+ * on it and a water tint fading out below, for a streaming texture drawn over the background.
+ * Every buffer is sized in the constructor.
+ */
+class WaterSurface
+{
+    public:
+        WaterSurface(int columns, int rows, const WorldMetrics& world);
+
+        void disturb(float worldX, float strength);
+        void step();
+        void rasterize();
+
+        int getColumns() const { return columns; }
+        int getRows() const { return rows; }
+        const uint32_t* getPixels() const { return pixels.data(); }
+        float getTop() const { return surfaceY - band; }      // World y of the strip's top row
+        float getHeight() const { return 2 * band; }         // World height of the strip
+
+        static const int LANES = 4; // Columns per SSE register
+
+    private:
+        int columns;
+        int rows;
+        float worldW;
+        float surfaceY;
+        float band;                     // Half the strip's height, and the furthest a ripple goes
+
+        // Column c is at c + 1; 0 and everything past columns stay flat
+        std::vector<float> heights;     // Positive is down, like screen y
+        std::vector<float> previous;
+        std::vector<uint32_t> pixels;   // rows x columns, ARGB8888
+};
+
+#endif // WATER_SURFACE_HPP
@@ -0,0 +1,48 @@
+// Resolution-dependent sizes and limits, computed once per resolution
+#ifndef WORLD_METRICS_HPP
+#define WORLD_METRICS_HPP
+
+/**
+ * @struct WorldMetrics
+ * @brief Every scaled constant the fishing logic and views need, in units of one space
+ * @details FishingLogic always runs in world() space (Dimens::WORLD_W x WORLD_H), so every
+ * window size plays the same; views build fromScreen() metrics for their pixel-space UI and
+ * map world coordinates to the window with a single render scale.
+ */
+struct WorldMetrics
+{
+    float screenW = 0.0f;
+    float screenH = 0.0f;
+    float centerX = 0.0f;
+    float centerY = 0.0f;
+    float widthScale = 1.0f;    // Scale::getWidthScaleFactor
+    float heightScale = 1.0f;   // Scale::getHeightScaleFactor
+
+    // Pond and rod limits
+    float surfaceY = 0.0f;      // Waterline
+    float rodMinY = 0.0f;
+    float rodMaxY = 0.0f;
+    float rodRadiusX = 0.0f;    // Visual hook radii
+    float rodRadiusY = 0.0f;
+    float rodHitRadiusX = 0.0f; // Slightly bigger hitbox than the visual hook
+    float rodHitRadiusY = 0.0f;
+    float rodSpeed = 0.0f;      // Base rod speed before upgrades
+
+    // Floater sizes and base speeds
+    float fishW = 0.0f, fishH = 0.0f, fishSpeed = 0.0f;
+    float mediumFishW = 0.0f, mediumFishH = 0.0f, mediumFishSpeed = 0.0f;
+    float bigFishW = 0.0f, bigFishH = 0.0f, bigFishSpeed = 0.0f;
+    float hazardW = 0.0f, hazardH = 0.0f;
+    float heavyHazardW = 0.0f, heavyHazardH = 0.0f;
+    float shockHazardW = 0.0f, shockHazardH = 0.0f;
+    float hazardSpeed = 0.0f;
+
+    float scaleW(float widthPercent) const { return screenW * widthPercent; }
+    float scaleH(float heightPercent) const { return screenH * heightPercent; }
+
+    static WorldMetrics fromScreen(float width, float height);
+    static WorldMetrics fromCurrentScreen(); // From the Dimens:: globals set by main/resolution changes
+    static WorldMetrics world();             // Fixed simulation space
+};
+
+#endif // WORLD_METRICS_HPP
@@ -0,0 +1,295 @@
+#include <atomic> // For the enabled flag and charged accounts
+#include <mutex> // Zones can close on lane worker threads
+#include <cstdlib> // For malloc and free
+#include <cstring> // For zone name comparison
+#include <new> // For the replaced operators
+#include <iomanip> // For report formatting
+
+#include "alloc_tracker.hpp" // Namespace header
+
+namespace
+{
+    std::atomic<bool> trackingEnabled(false);
+
+    // Plain thread_local integers need no constructor, so operator new can touch them at any time
+    thread_local uint64_t threadAllocations = 0;
+    thread_local uint64_t threadBytes = 0;
+
+}
+
+/**
+ * @struct AllocTracker::Account
+ * @brief Counts moved to a thread by AllocCharge on other threads
+ */
+struct AllocTracker::Account
+{
+    std::atomic<uint64_t> allocations;
+    std::atomic<uint64_t> bytes;
+};
+
+namespace
+{
+    // Constant-initialized and trivially destructible, like the counters above
+    thread_local AllocTracker::Account threadCharges = {{0}, {0}};
+
+    std::mutex statsMutex;
+    AllocTracker::ZoneStats zones[AllocTracker::MAX_ZONES];
+    int zoneCount = 0;
+
+    // Frames as marked by beginFrame()/endFrame() on the game thread
+    AllocTracker::Counts frameStart = {0, 0};
+    uint64_t frames = 0;
+    uint64_t allocatingFrames = 0;
+    uint64_t frameAllocations = 0;
+    uint64_t maxFrameAllocations = 0;
+
+    void* countedAlloc(std::size_t size)
+    {
+        if (trackingEnabled.load(std::memory_order_relaxed)) {
+            threadAllocations++;
+            threadBytes += size;
+        }
+        void* memory = std::malloc(size ? size : 1);
+        if (!memory) {
+            throw std::bad_alloc();
+        }
+        return memory;
+    }
+
+    void* countedAllocNoThrow(std::size_t size) noexcept
+    {
+        if (trackingEnabled.load(std::memory_order_relaxed)) {
+            threadAllocations++;
+            threadBytes += size;
+        }
+        return std::malloc(size ? size : 1);
+    }
+
+    /**
+     * @brief Finds or adds a zone; caller holds statsMutex
+     * @return int zone index, -1 when the table is full
+     */
+    int zoneIndex(const char* name)
+    {
+        for (int i = 0; i < zoneCount; i++) {
+            if (zones[i].name == name || std::strcmp(zones[i].name, name) == 0) {
+                return i;
+            }
+        }
+        if (zoneCount == AllocTracker::MAX_ZONES) {
+            return -1;
+        }
+        zones[zoneCount] = {name, 0, 0, 0, 0};
+        return zoneCount++;
+    }
+}
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAllocNoThrow(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAllocNoThrow(size); }
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+
+/**
+ * @brief Starts or stops counting on every thread
+ */
+void AllocTracker::setEnabled(bool enabled)
+{
+    trackingEnabled.store(enabled);
+}
+
+bool AllocTracker::isEnabled()
+{
+    return trackingEnabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Allocations made on the calling thread while tracking was enabled
+ */
+AllocTracker::Counts AllocTracker::threadCounts()
+{
+    return {threadAllocations + threadCharges.allocations.load(std::memory_order_relaxed),
+            threadBytes + threadCharges.bytes.load(std::memory_order_relaxed)};
+}
+
+/**
+ * @brief The calling thread's account, for charging work done on its behalf elsewhere
+ */
+AllocTracker::Account* AllocTracker::threadAccount()
+{
+    return &threadCharges;
+}
+
+/**
+ * @brief Marks the start of a frame on the game thread
+ */
+void AllocTracker::beginFrame()
+{
+    frameStart = threadCounts();
+}
+
+/**
+ * @brief Closes the frame opened by beginFrame() and adds it to the frame totals
+ */
+void AllocTracker::endFrame()
+{
+    if (!isEnabled()) {
+        return;
+    }
+    uint64_t allocations = threadCounts().allocations - frameStart.allocations;
+    std::lock_guard<std::mutex> lock(statsMutex);
+    frames++;
+    frameAllocations += allocations;
+    if (allocations > 0) {
+        allocatingFrames++;
+    }
+    if (allocations > maxFrameAllocations) {
+        maxFrameAllocations = allocations;
+    }
+}
+
+/**
+ * @brief Copies one zone's totals
+ * @param name Zone name
+ * @param stats Receives the totals
+ * @return bool false if the zone never ran while tracking
+ */
+bool AllocTracker::getZoneStats(const char* name, ZoneStats& stats)
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    for (int i = 0; i < zoneCount; i++) {
+        if (std::strcmp(zones[i].name, name) == 0) {
+            stats = zones[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Zeroes frame and zone totals, e.g. after a warm-up period
+ */
+void AllocTracker::resetStats()
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    for (int i = 0; i < zoneCount; i++) {
+        zones[i] = {zones[i].name, 0, 0, 0, 0};
+    }
+    frames = 0;
+    allocatingFrames = 0;
+    frameAllocations = 0;
+    maxFrameAllocations = 0;
+}
+
+/**
+ * @brief Prints frame totals and every zone, flagging zones that allocated
+ * @param out Stream to print to
+ */
+void AllocTracker::report(std::ostream& out)
+{
+    // Formatting can allocate; take a copy first and stop counting while printing
+    bool wasEnabled = isEnabled();
+    setEnabled(false);
+
+    ZoneStats zoneCopy[MAX_ZONES];
+    int count;
+    uint64_t frameCount, allocatingFrameCount, frameTotal, frameMax;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        count = zoneCount;
+        for (int i = 0; i < count; i++) {
+            zoneCopy[i] = zones[i];
+        }
+        frameCount = frames;
+        allocatingFrameCount = allocatingFrames;
+        frameTotal = frameAllocations;
+        frameMax = maxFrameAllocations;
+    }
+
+    out << "Allocation report:" << std::endl;
+    if (frameCount > 0) {
+        out << "  Frames: " << frameCount << "  allocating " << allocatingFrameCount
+            << "  allocations/frame mean " << std::fixed << std::setprecision(2)
+            << static_cast<double>(frameTotal) / frameCount << "  max " << frameMax << std::endl;
+    }
+    for (int i = 0; i < count; i++) {
+        const ZoneStats& zone = zoneCopy[i];
+        out << "  " << std::left << std::setw(28) << zone.name << std::right
+            << " calls " << zone.calls << "  allocating " << zone.allocatingCalls
+            << "  allocations " << zone.allocations << "  bytes " << zone.bytes
+            << (zone.allocatingCalls ? "  <- allocates" : "") << std::endl;
+    }
+
+    setEnabled(wasEnabled);
+}
+
+/**
+ * @brief Opens a zone; does nothing while tracking is off
+ * @param name Zone name, a string literal
+ */
+AllocZone::AllocZone(const char* name) :
+    zone(-1),
+    start(AllocTracker::threadCounts())
+{
+    if (!AllocTracker::isEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(statsMutex);
+    zone = zoneIndex(name);
+}
+
+/**
+ * @brief Adds this thread's allocations since the constructor to the zone
+ */
+AllocZone::~AllocZone()
+{
+    if (zone < 0) {
+        return;
+    }
+    AllocTracker::Counts end = AllocTracker::threadCounts();
+    uint64_t allocations = end.allocations - start.allocations;
+    std::lock_guard<std::mutex> lock(statsMutex);
+    AllocTracker::ZoneStats& stats = zones[zone];
+    stats.calls++;
+    stats.allocations += allocations;
+    stats.bytes += end.bytes - start.bytes;
+    if (allocations > 0) {
+        stats.allocatingCalls++;
+    }
+}
+
+/**
+ * @brief Starts charging this thread's allocations to an account
+ * @param account Account to charge, nullptr or this thread's own to charge nothing
+ */
+AllocCharge::AllocCharge(AllocTracker::Account* account) :
+    account(account == &threadCharges ? nullptr : account),
+    start(AllocTracker::threadCounts())
+{
+}
+
+/**
+ * @brief Moves this thread's allocations since the constructor to the account
+ */
+AllocCharge::~AllocCharge()
+{
+    if (!account) {
+        return;
+    }
+    AllocTracker::Counts end = AllocTracker::threadCounts();
+    uint64_t allocations = end.allocations - start.allocations;
+    if (allocations == 0) {
+        return;
+    }
+    uint64_t bytes = end.bytes - start.bytes;
+    // Unsigned wrap-around keeps every difference taken across this point correct
+    threadAllocations -= allocations;
+    threadBytes -= bytes;
+    account->allocations.fetch_add(allocations, std::memory_order_relaxed);
+    account->bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
@@ -0,0 +1,240 @@
+#include <algorithm> // For mix lengths
+#include <iostream> // For device and load messages
+#include <string> // For sound paths
+
+#include "audio_engine.hpp" // Class header
+#include "game_constants.hpp" // For sound paths
+
+namespace
+{
+    /**
+     * @struct SoundInfo
+     * @brief Where a sound is loaded from and how hard it holds on to a voice
+     */
+    struct SoundInfo
+    {
+        const std::string& path;
+        int priority; // Higher steals lower
+    };
+
+    // Indexed by SoundId
+    const SoundInfo SOUND_INFO[] = {
+        {Resource::SFX_CAST, 0},
+        {Resource::SFX_HOOK, 2},
+        {Resource::SFX_CATCH, 3},
+        {Resource::SFX_RELEASE, 1},
+        {Resource::SFX_HAZARD_HIT, 2},
+        {Resource::SFX_STUN, 3}
+    };
+    static_assert(sizeof(SOUND_INFO) / sizeof(SOUND_INFO[0]) == static_cast<size_t>(SoundId::COUNT),
+                  "Every sound needs a path and priority");
+}
+
+AudioEngine::~AudioEngine()
+{
+    close();
+}
+
+/**
+ * @brief Opens the audio device and decodes every sound effect
+ * @details Missing sound files are reported and stay silent; the rest still play.
+ * @return bool false if there is no usable audio device; the game runs silent then
+ */
+bool AudioEngine::open()
+{
+    if (opened) {
+        return true;
+    }
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
+        std::cerr << "AudioEngine: Could not initialize SDL audio: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    if (Mix_OpenAudio(SAMPLE_RATE, AUDIO_S16SYS, 2, BUFFER_FRAMES) < 0) {
+        std::cerr << "AudioEngine: Could not open the audio device: " << Mix_GetError() << std::endl;
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        return false;
+    }
+
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    Mix_QuerySpec(&frequency, &format, &channels);
+    if (format != AUDIO_S16SYS || frequency <= 0) {
+        std::cerr << "AudioEngine: Device did not accept 16-bit samples" << std::endl;
+        Mix_CloseAudio();
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        return false;
+    }
+    Mix_AllocateChannels(0); // Voices are mixed by the engine, not on mixer channels
+    bufferMs = 1000.0 * BUFFER_FRAMES / frequency;
+    counterFrequency = SDL_GetPerformanceFrequency();
+
+    int loaded = 0;
+    for (int i = 0; i < SOUNDS; i++) {
+        chunks[i] = Mix_LoadWAV(SOUND_INFO[i].path.c_str());
+        if (chunks[i]) {
+            loaded++;
+        } else {
+            std::cerr << "AudioEngine: Could not load " << SOUND_INFO[i].path << ": " << Mix_GetError() << std::endl;
+        }
+    }
+
+    Mix_SetPostMix(&AudioEngine::postMix, this);
+    opened = true;
+    std::cout << "AudioEngine: " << frequency << " Hz, " << channels << " channel(s), " << BUFFER_FRAMES
+              << " frame buffer, " << loaded << "/" << SOUNDS << " sounds loaded" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Stops mixing, frees the sounds and closes the device
+ */
+void AudioEngine::close()
+{
+    if (!opened) {
+        return;
+    }
+    Mix_SetPostMix(nullptr, nullptr); // Takes the audio lock, so no callback is still using the chunks
+    for (Mix_Chunk*& chunk : chunks) {
+        if (chunk) {
+            Mix_FreeChunk(chunk);
+            chunk = nullptr;
+        }
+    }
+    Mix_CloseAudio();
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    opened = false;
+}
+
+/**
+ * @brief Asks for a sound to start with the next mixed buffer; lock-free and allocation-free
+ * @details Call from one thread only (the game thread).
+ * @param sound Sound to play
+ * @return bool false if audio is off, the sound failed to load or the trigger ring is full
+ */
+bool AudioEngine::trigger(SoundId sound)
+{
+    int index = static_cast<int>(sound);
+    if (!opened || index < 0 || index >= SOUNDS || !chunks[index]) {
+        return false;
+    }
+    if (!triggers.push({sound, SDL_GetPerformanceCounter()})) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Plays the sound for a fishing event
+ */
+void AudioEngine::triggerEvent(FishingEventType type)
+{
+    switch (type) {
+        case FishingEventType::CAST:
+            trigger(SoundId::CAST);
+            break;
+        case FishingEventType::HOOKED:
+            trigger(SoundId::HOOK);
+            break;
+        case FishingEventType::LANDED:
+            trigger(SoundId::CATCH);
+            break;
+        case FishingEventType::KNOCKED_OFF:
+            trigger(SoundId::RELEASE);
+            break;
+        case FishingEventType::HAZARD_HIT:
+            trigger(SoundId::HAZARD_HIT);
+            break;
+        case FishingEventType::STUNNED:
+            trigger(SoundId::STUN);
+            break;
+    }
+}
+
+/**
+ * @brief Moves the audio thread's trigger-to-output samples into the telemetry; game thread only
+ */
+void AudioEngine::collectLatencies(FrameTelemetry& telemetry)
+{
+    double latencyMs;
+    while (latencies.pop(latencyMs)) {
+        telemetry.recordAudioLatency(latencyMs);
+    }
+}
+
+/**
+ * @brief SDL_mixer post-mix callback, on the audio thread with the audio lock held
+ */
+void AudioEngine::postMix(void* engine, Uint8* stream, int length)
+{
+    static_cast<AudioEngine*>(engine)->mix(reinterpret_cast<Sint16*>(stream), length / static_cast<int>(sizeof(Sint16)));
+}
+
+/**
+ * @brief Starts the pending triggers and adds every playing voice into the buffer
+ * @param out Device buffer, interleaved 16-bit samples
+ * @param samples Samples in the buffer, all channels
+ */
+void AudioEngine::mix(Sint16* out, int samples)
+{
+    Trigger request;
+    while (triggers.pop(request)) {
+        start(request);
+    }
+
+    for (Voice& voice : voices) {
+        if (!voice.samples) {
+            continue;
+        }
+        int count = std::min(samples, voice.length - voice.position);
+        const Sint16* source = voice.samples + voice.position;
+        for (int i = 0; i < count; i++) {
+            int sum = out[i] + source[i];
+            out[i] = static_cast<Sint16>(std::min(32767, std::max(-32768, sum)));
+        }
+        voice.position += count;
+        if (voice.position >= voice.length) {
+            voice.samples = nullptr;
+        }
+    }
+}
+
+/**
+ * @brief Puts a triggered sound on a free voice, or steals the weakest voice it outranks or ties
+ * @param request Trigger to start
+ */
+void AudioEngine::start(const Trigger& request)
+{
+    int index = static_cast<int>(request.sound);
+    const Mix_Chunk* chunk = chunks[index];
+    int priority = SOUND_INFO[index].priority;
+
+    Voice* chosen = nullptr;
+    for (Voice& voice : voices) {
+        if (!voice.samples) {
+            chosen = &voice;
+            break;
+        }
+        // Weakest first, then oldest
+        if (voice.priority <= priority &&
+            (!chosen || voice.priority < chosen->priority ||
+             (voice.priority == chosen->priority && voice.serial < chosen->serial))) {
+            chosen = &voice;
+        }
+    }
+    if (!chosen) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    chosen->samples = reinterpret_cast<const Sint16*>(chunk->abuf);
+    chosen->length = static_cast<int>(chunk->alen / sizeof(Sint16));
+    chosen->position = 0;
+    chosen->priority = priority;
+    chosen->serial = nextSerial++;
+
+    // The buffer being mixed plays once the one queued ahead of it has
+    Uint64 waited = SDL_GetPerformanceCounter() - request.time;
+    latencies.push(waited * 1000.0 / counterFrequency + bufferMs);
+}
@@ -0,0 +1,149 @@
+#include <cmath> // For distances
+#include <algorithm> // For clamping
+
+#include "bot.hpp" // Class header
+#include "fishing_logic.hpp" // For catch rules
+
+/**
+ * @brief Builds a bot by name
+ * @param name Bot name, currently only "greedy"
+ * @return std::unique_ptr<Bot> new bot, nullptr if the name is unknown
+ */
+std::unique_ptr<Bot> Bot::create(const std::string& name)
+{
+    if (name == "greedy") {
+        return std::unique_ptr<Bot>(new GreedyBot());
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Picks the input for this tick
+ * @param observation Current round state
+ * @return UserInput::Action rod input
+ */
+UserInput::Action GreedyBot::nextAction(const BotObservation& observation)
+{
+    if (observation.stunned) {
+        return UserInput::Action::NONE;
+    }
+
+    float hookY = observation.rodPosition.y;
+    UserInput::Action desired = UserInput::Action::NONE;
+
+    if (observation.fishHooked || observation.heavyHazardHooked) {
+        // Release only once clear of the water, where a fish scores
+        if (hookY + observation.rodHalfHeight < observation.surfaceY) {
+            return UserInput::Action::RELEASE;
+        }
+        desired = UserInput::Action::MOVEUP;
+    }
+    else {
+        float targetY = hookY;
+        if (findTarget(observation, targetY)) {
+            if (targetY > hookY + observation.rodHalfHeight / 2) {
+                desired = UserInput::Action::MOVEDOWN;
+            }
+            else if (targetY < hookY - observation.rodHalfHeight / 2) {
+                desired = UserInput::Action::MOVEUP;
+            }
+        }
+    }
+
+    // Try the desired move first, then holding, then backing off; keep the one that stays clear longest
+    UserInput::Action candidates[3] = {desired, UserInput::Action::NONE,
+        desired == UserInput::Action::MOVEUP ? UserInput::Action::MOVEDOWN : UserInput::Action::MOVEUP};
+    UserInput::Action best = desired;
+    int bestTicks = -1;
+    for (UserInput::Action candidate : candidates) {
+        float velocity = 0.0f;
+        if (candidate == UserInput::Action::MOVEUP) {
+            velocity = -observation.rodSpeed;
+        }
+        else if (candidate == UserInput::Action::MOVEDOWN) {
+            velocity = observation.rodSpeed;
+        }
+
+        int ticks = ticksUntilHazard(observation, velocity);
+        if (ticks > LOOKAHEAD_TICKS) {
+            return candidate;
+        }
+        if (ticks > bestTicks) {
+            bestTicks = ticks;
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Finds the height of the catchable fish the hook can meet soonest
+ * @param observation Current round state
+ * @param targetY Set to the fish's mouth height when a target is found
+ * @return bool false if no catchable fish is heading toward the hook
+ */
+bool GreedyBot::findTarget(const BotObservation& observation, float& targetY) const
+{
+    float hookX = observation.rodPosition.x;
+    float hookY = observation.rodPosition.y;
+    float bestCost = -1.0f;
+
+    for (const auto& fish : observation.fish) {
+        if (!FishingLogic::canCatch(fish.kind, observation.rodLevel)) {
+            continue;
+        }
+
+        // Mouth hitbox matches FishingLogic::checkFloaterCaught
+        float mouthSize = fish.dimens.y / 2;
+        float mouthX = fish.velocity.x > 0
+            ? fish.position.x + fish.dimens.x - mouthSize - 5
+            : fish.position.x + 5;
+        mouthX += mouthSize / 2;
+        float mouthY = fish.position.y + fish.dimens.y / 2;
+
+        float gap = hookX - mouthX;
+        float ticksToHook = 0.0f;
+        if (std::fabs(gap) > observation.rodHalfWidth) {
+            if (fish.velocity.x == 0.0f || gap / fish.velocity.x < 0.0f) {
+                continue; // Swimming away from the hook
+            }
+            ticksToHook = gap / fish.velocity.x;
+        }
+
+        float ticksToDepth = observation.rodSpeed > 0.0f ? std::fabs(mouthY - hookY) / observation.rodSpeed : 0.0f;
+        float cost = std::max(ticksToHook, ticksToDepth);
+        if (bestCost < 0.0f || cost < bestCost) {
+            bestCost = cost;
+            targetY = std::max(observation.rodMinY, std::min(mouthY, observation.rodMaxY));
+        }
+    }
+    return bestCost >= 0.0f;
+}
+
+/**
+ * @brief Plays the hook and hazards forward to find the first collision
+ * @param observation Current round state
+ * @param rodVelocity Hook velocity to test, pixels per tick
+ * @return int ticks until the hook touches a hazard, LOOKAHEAD_TICKS + 1 if it stays clear
+ */
+int GreedyBot::ticksUntilHazard(const BotObservation& observation, float rodVelocity) const
+{
+    float hookX = observation.rodPosition.x;
+    float marginX = observation.rodHalfWidth * 1.5f;
+    float marginY = observation.rodHalfHeight * 1.5f;
+
+    for (int tick = 0; tick <= LOOKAHEAD_TICKS; tick++) {
+        float hookY = observation.rodPosition.y + rodVelocity * tick;
+        hookY = std::max(observation.rodMinY, std::min(hookY, observation.rodMaxY));
+
+        for (const auto& hazard : observation.hazards) {
+            float left = hazard.position.x + hazard.velocity.x * tick;
+            float top = hazard.position.y + hazard.velocity.y * tick;
+            if (hookX + marginX > left && hookX - marginX < left + hazard.dimens.x &&
+                hookY + marginY > top && hookY - marginY < top + hazard.dimens.y) {
+                return tick;
+            }
+        }
+    }
+    return LOOKAHEAD_TICKS + 1;
+}
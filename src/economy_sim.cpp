@@ -0,0 +1,307 @@
+#include <iostream> // For report output
+#include <iomanip> // For report formatting
+#include <thread> // For core count
+#include <chrono> // For run timing
+#include <random> // For per-campaign seeds
+#include <algorithm> // For sorting days to victory
+
+#include "economy_sim.hpp" // Class header
+#include "fishing_logic.hpp" // For headless rounds
+#include "level_config.hpp" // For per-day spawn values
+#include "game_constants.hpp" // For prices and economy values
+#include "bot.hpp" // For scripted rounds
+#include "job_system.hpp" // Campaigns run on the shared pool
+
+namespace
+{
+    const Uint32 SIM_FRAME_MS = 16; // Matches the game's 60 FPS frame cap
+
+    /**
+     * @brief Value at a percentile of a sorted list
+     * @param sorted Ascending values
+     * @param percent 0 to 100
+     * @return int nearest-rank percentile
+     */
+    int percentile(const std::vector<int>& sorted, int percent)
+    {
+        size_t rank = (sorted.size() * percent + 99) / 100;
+        return sorted[rank == 0 ? 0 : rank - 1];
+    }
+}
+
+/**
+ * @brief Default config plays in the same world space as the game
+ */
+SimConfig::SimConfig() :
+    metrics(WorldMetrics::world())
+{
+}
+
+/**
+ * @brief Looks up a built-in purchase policy
+ * @param name "balanced", "saver" or "upgrader"
+ * @param policy Filled in on success
+ * @return bool false if the name is unknown
+ */
+bool PurchasePolicy::fromName(const std::string& name, PurchasePolicy& policy)
+{
+    PurchasePolicy preset;
+    preset.name = name;
+    if (name == "balanced") {
+        // Defaults: a few upgrades early, loan payments with what is left
+    }
+    else if (name == "saver") {
+        preset.loanFirst = true;
+        preset.maxRodLevel = 1;
+        preset.maxClockLevel = 0;
+        preset.maxRegisterLevel = 1;
+        preset.maxLedgerLevel = 0;
+    }
+    else if (name == "upgrader") {
+        preset.cashReserve = 15;
+        preset.maxRodLevel = 6;
+        preset.maxClockLevel = 4;
+        preset.maxRegisterLevel = 6;
+        preset.maxLedgerLevel = 4;
+    }
+    else {
+        return false;
+    }
+    policy = preset;
+    return true;
+}
+
+/**
+ * @brief Sets up a batch of campaigns
+ * @param config Batch parameters; threads <= 0 uses every core
+ */
+EconomySimulator::EconomySimulator(const SimConfig& config) : config(config)
+{
+    threadCount = config.threads > 0 ? config.threads : static_cast<int>(std::thread::hardware_concurrency());
+    if (threadCount <= 0) {
+        threadCount = 1;
+    }
+    threadCount = std::min(threadCount, std::max(1, config.campaigns));
+    threadCount = std::min(threadCount, JobSystem::shared().getWorkerCount() + 1); // Pool workers plus the caller
+}
+
+/**
+ * @brief Plays every campaign across the shared job system
+ * @return std::vector<CampaignResult> one result per campaign, in campaign order
+ */
+std::vector<CampaignResult> EconomySimulator::run()
+{
+    std::vector<CampaignResult> results(std::max(0, config.campaigns));
+    auto startTime = std::chrono::steady_clock::now();
+
+    JobSystem::shared().parallelFor(config.campaigns, 1, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            results[i] = playCampaign(config, config.seed * 1000003u + static_cast<unsigned int>(i));
+        }
+    }, threadCount);
+
+    lastRunSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return results;
+}
+
+/**
+ * @brief Spends cash the way a player following the policy would between days
+ * @param player Player to shop for
+ * @param policy Upgrade caps, reserve and priorities
+ */
+void EconomySimulator::visitStore(PlayerData& player, const PurchasePolicy& policy)
+{
+    auto canAfford = [&](int cost) {
+        return player.getCash() - cost >= policy.cashReserve;
+    };
+    auto payLoan = [&]() {
+        while (!player.isLoanPaid() && canAfford(Game::LOAN_PAYMENT)) {
+            player.payLoan(Game::LOAN_PAYMENT);
+        }
+    };
+
+    if (policy.loanFirst) {
+        payLoan();
+    }
+
+    // Buy one level at a time, cheapest useful upgrade first, until nothing fits
+    bool bought = true;
+    while (bought) {
+        bought = false;
+        if (player.getRodLevel() < policy.maxRodLevel && canAfford(Game::ROD_PRICE)) {
+            player.spendCash(Game::ROD_PRICE);
+            player.upgradeRod();
+            bought = true;
+        }
+        if (player.getRegisterLevel() < policy.maxRegisterLevel && canAfford(Game::REGISTER_PRICE)) {
+            player.spendCash(Game::REGISTER_PRICE);
+            player.upgradeRegister();
+            bought = true;
+        }
+        if (player.getLedgerLevel() < policy.maxLedgerLevel && canAfford(Game::LEDGER_PRICE)) {
+            player.spendCash(Game::LEDGER_PRICE);
+            player.upgradeLedger();
+            bought = true;
+        }
+        if (player.getClockLevel() < policy.maxClockLevel && canAfford(Game::CLOCK_PRICE)) {
+            player.spendCash(Game::CLOCK_PRICE);
+            player.upgradeClock();
+            bought = true;
+        }
+    }
+
+    payLoan();
+}
+
+/**
+ * @brief Plays one headless fishing round for the player's current day and upgrades
+ * @param player Player whose day, rod and clock level set up the round
+ * @param metrics Resolution the round is played at
+ * @param bot Bot providing the input each tick
+ * @param seed Seed for the round's spawns and speeds
+ * @return int catch score for the round
+ */
+int EconomySimulator::playRound(const PlayerData& player, const WorldMetrics& metrics, Bot& bot, unsigned int seed)
+{
+    int roundDuration = Game::ROUND_DURATION + (player.getClockLevel() * 10 * 1000);
+    FishingLogic logic(LevelTable::global().getLevel(player.getDayCount()), roundDuration,
+                       player.getRodLevel(), metrics, false, true);
+    logic.seedRandom(seed);
+    logic.setRunning(true);
+    logic.spawnNewFloaters();
+    logic.resetRoundStartTime();
+
+    BotObservation observation;
+    int maxFrames = roundDuration / static_cast<int>(SIM_FRAME_MS) + 2;
+    for (int frame = 0; frame < maxFrames && logic.getRunning(); frame++) {
+        logic.observe(observation);
+        logic.handleUserInput(bot.nextAction(observation));
+        logic.update();
+        logic.advanceClock(SIM_FRAME_MS);
+    }
+    return logic.getCatchScore();
+}
+
+/**
+ * @brief Plays a campaign from day 1 until victory, bankruptcy or the day limit
+ * @param config Policy and day limit
+ * @param seed Campaign seed; each round draws its own seed from it
+ * @return CampaignResult outcome of the campaign
+ */
+CampaignResult EconomySimulator::playCampaign(const SimConfig& config, unsigned int seed)
+{
+    std::mt19937 campaignRng(seed);
+    std::unique_ptr<Bot> bot = Bot::create(config.botName);
+    PlayerData player;
+    CampaignResult result;
+
+    while (true) {
+        visitStore(player, config.policy);
+        if (player.isLoanPaid()) {
+            result.victory = true;
+            break;
+        }
+        if (player.getDayCount() > config.maxDays) {
+            break;
+        }
+
+        int catchScore = bot ? playRound(player, config.metrics, *bot, campaignRng()) : 0;
+        player.settleDay(catchScore);
+        if (player.getCash() < 0) {
+            result.gameOver = true;
+            break;
+        }
+        player.advanceDay();
+    }
+
+    result.days = player.getDayCount();
+    result.finalCash = player.getCash();
+    result.finalLoan = player.getLoanAmount();
+    result.totalFish = player.getTotalFishCaught();
+    return result;
+}
+
+/**
+ * @brief Prints outcome rates and the days-to-victory distribution
+ * @param results Results from run()
+ * @param out Stream to print to
+ */
+void EconomySimulator::printReport(const std::vector<CampaignResult>& results, std::ostream& out) const
+{
+    if (results.empty()) {
+        out << "Economy simulation: no campaigns run" << std::endl;
+        return;
+    }
+
+    int victories = 0;
+    int gameOvers = 0;
+    long long totalFish = 0;
+    long long gameOverDays = 0;
+    std::vector<int> victoryDays;
+    for (const auto& result : results) {
+        if (result.victory) {
+            victories++;
+            victoryDays.push_back(result.days);
+        }
+        else if (result.gameOver) {
+            gameOvers++;
+            gameOverDays += result.days;
+        }
+        totalFish += result.totalFish;
+    }
+    int stalled = static_cast<int>(results.size()) - victories - gameOvers;
+    double total = static_cast<double>(results.size());
+
+    out << std::fixed << std::setprecision(1);
+    out << "Economy simulation: " << results.size() << " campaigns, policy '" << config.policy.name
+        << "', bot '" << config.botName << "', " << threadCount << " threads, " << lastRunSeconds << " s" << std::endl;
+    out << "  Victory:   " << std::setw(5) << 100.0 * victories / total << "% (" << victories << ")" << std::endl;
+    out << "  Game over: " << std::setw(5) << 100.0 * gameOvers / total << "% (" << gameOvers << ")" << std::endl;
+    out << "  Stalled:   " << std::setw(5) << 100.0 * stalled / total << "% (" << stalled
+        << ", loan not paid by day " << config.maxDays << ")" << std::endl;
+    out << "  Fish per campaign: " << totalFish / total << std::endl;
+    if (gameOvers > 0) {
+        out << "  Mean day of bankruptcy: " << static_cast<double>(gameOverDays) / gameOvers << std::endl;
+    }
+
+    if (victoryDays.empty()) {
+        return;
+    }
+
+    std::sort(victoryDays.begin(), victoryDays.end());
+    double meanDays = 0.0;
+    for (int days : victoryDays) {
+        meanDays += days;
+    }
+    meanDays /= victoryDays.size();
+
+    out << "  Days to victory: min " << victoryDays.front()
+        << "  p10 " << percentile(victoryDays, 10)
+        << "  p50 " << percentile(victoryDays, 50)
+        << "  p90 " << percentile(victoryDays, 90)
+        << "  max " << victoryDays.back()
+        << "  mean " << meanDays << std::endl;
+
+    // Histogram with at most 20 buckets, bars scaled to 50 columns
+    const int maxBuckets = 20;
+    const int barWidth = 50;
+    int first = victoryDays.front();
+    int span = victoryDays.back() - first + 1;
+    int bucketSize = (span + maxBuckets - 1) / maxBuckets;
+    int buckets = (span + bucketSize - 1) / bucketSize;
+    std::vector<int> counts(buckets, 0);
+    for (int days : victoryDays) {
+        counts[(days - first) / bucketSize]++;
+    }
+    int tallest = *std::max_element(counts.begin(), counts.end());
+
+    for (int b = 0; b < buckets; b++) {
+        int low = first + b * bucketSize;
+        int high = low + bucketSize - 1;
+        out << "  " << std::setw(4) << low;
+        if (bucketSize > 1) {
+            out << "-" << std::setw(4) << std::left << high << std::right;
+        }
+        out << " | " << std::string(counts[b] * barWidth / tallest, '#') << " " << counts[b] << std::endl;
+    }
+}
@@ -0,0 +1,253 @@
+#include <algorithm> // For clamps and fills
+#include <cmath> // For speed magnitudes
+
+#include "fish_school.hpp" // Class header
+#include "game_constants.hpp" // For schooling weights
+#include "job_system.hpp" // For parallel steering
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h> // For the 4-wide neighbour kernel
+#define FISH_SCHOOL_SSE
+#endif
+
+/**
+ * @brief Sizes every buffer for the round so steering never allocates
+ * @param fishCount Fish pool size
+ * @param metrics Round metrics, for pond limits and fish size
+ */
+void FishSchool::reserve(size_t fishCount, const WorldMetrics& metrics)
+{
+    cellSize = std::max(1.0f, metrics.fishW * Game::SCHOOL_NEIGHBOR_RADIUS);
+    originX = -cellSize;
+    gridW = static_cast<int>(std::ceil((metrics.screenW + 2 * cellSize) / cellSize));
+    gridH = static_cast<int>(std::ceil(metrics.screenH / cellSize)) + 1;
+    radius2 = cellSize * cellSize;
+    separationRadius = metrics.fishW * Game::SCHOOL_SEPARATION_RADIUS;
+
+    topY = metrics.surfaceY;
+    bottomY = metrics.rodMaxY - metrics.fishH;
+    edgeMargin = metrics.fishH;
+    minSpeed = Game::SCHOOL_MIN_SPEED * metrics.widthScale;
+    maxSpeed = Game::MAX_FISH_SPEED * metrics.widthScale;
+    maxVerticalSpeed = Game::SCHOOL_MAX_VERTICAL_SPEED * metrics.heightScale;
+    edgePush = Game::SCHOOL_EDGE_PUSH * metrics.heightScale;
+
+    for (std::vector<float>* buffer : {&posX, &posY, &velX, &velY, &steeredX, &steeredY}) {
+        buffer->assign(fishCount, 0.0f);
+    }
+    for (std::vector<int>* buffer : {&slot, &cell, &gatheredSlot, &gatheredCell}) {
+        buffer->assign(fishCount, 0);
+    }
+    cellStart.assign(gridW * gridH + 1, 0);
+    cellFill.assign(gridW * gridH, 0);
+}
+
+/**
+ * @brief Grid cell of a position; positions off the grid use the nearest edge cell
+ */
+int FishSchool::cellFor(float x, float y) const
+{
+    int cx = std::min(gridW - 1, std::max(0, static_cast<int>((x - originX) / cellSize)));
+    int cy = std::min(gridH - 1, std::max(0, static_cast<int>(y / cellSize)));
+    return cy * gridW + cx;
+}
+
+/**
+ * @brief Sets the direction and speed of every free small fish for this tick's move
+ * @param fish Round's fish pool; only active, uncaught small fish are steered
+ * @param maxThreads Most threads to steer on, 0 for the whole job system
+ */
+void FishSchool::steer(FloaterPool<Fish>& fish, int maxThreads)
+{
+    // Gather in slot order, counting fish per cell
+    count = 0;
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    for (size_t i = 0; i < fish.size(); i++) {
+        const Fish& one = *fish[i];
+        if (!one.isActive() || one.isCaught() || one.getKind() != FloaterKind::SMALL_FISH) {
+            continue;
+        }
+        gatheredSlot[count] = static_cast<int>(i);
+        gatheredCell[count] = cellFor(one.getPosition().x, one.getPosition().y);
+        cellStart[gatheredCell[count] + 1]++;
+        count++;
+    }
+    if (count < 2) {
+        return; // Nobody to school with; a lone fish keeps its course
+    }
+
+    // Counting sort into cell order; stable, so the order never depends on timing
+    for (size_t c = 1; c < cellStart.size(); c++) {
+        cellStart[c] += cellStart[c - 1];
+    }
+    std::copy(cellStart.begin(), cellStart.end() - 1, cellFill.begin());
+    for (int k = 0; k < count; k++) {
+        int sorted = cellFill[gatheredCell[k]]++;
+        const Fish& one = *fish[gatheredSlot[k]];
+        slot[sorted] = gatheredSlot[k];
+        cell[sorted] = gatheredCell[k];
+        posX[sorted] = one.getPosition().x;
+        posY[sorted] = one.getPosition().y;
+        velX[sorted] = one.getDirection().x * one.getSpeed().x;
+        velY[sorted] = one.getDirection().y * one.getSpeed().y;
+    }
+
+    JobSystem::shared().parallelFor(count, Game::SCHOOL_STEER_GRAIN, [this](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            steerOne(i);
+        }
+    }, maxThreads);
+
+    // Heading stays in direction.x and the cruise speed in speed.x, as spawning set them up
+    for (int i = 0; i < count; i++) {
+        Fish& one = *fish[slot[i]];
+        one.setDirection(steeredX[i] > 0 ? 1.0f : -1.0f, 1.0f);
+        one.setSpeed(std::fabs(steeredX[i]), steeredY[i]);
+    }
+}
+
+/**
+ * @brief Adds one contiguous run of fish to a fish's neighbour sums, FishSchool::LANES at a time
+ * @details Branch-free: distance tests become masks that select which terms are added. With SSE2
+ * each group of lanes is one set of vector operations; otherwise the same lanes run in scalar
+ * code in the same order, so both paths give identical sums.
+ * @param first First fish of the run, in cell order
+ * @param last One past the last fish of the run
+ * @param fish Fish being steered
+ * @param sums Per-lane sums to add to
+ */
+void FishSchool::accumulateRun(int first, int last, int fish, NeighbourSums& sums) const
+{
+    const float x = posX[fish];
+    const float y = posY[fish];
+    const float vx = velX[fish];
+    const float separation2 = separationRadius * separationRadius;
+    int j = first;
+
+#ifdef FISH_SCHOOL_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 ownX = _mm_set1_ps(x);
+    const __m128 ownY = _mm_set1_ps(y);
+    const __m128 ownVX = _mm_set1_ps(vx);
+    const __m128 radius2Lanes = _mm_set1_ps(radius2);
+    const __m128 separation2Lanes = _mm_set1_ps(separation2);
+
+    __m128 flock = _mm_loadu_ps(sums.flock);
+    __m128 offsetX = _mm_loadu_ps(sums.offsetX);
+    __m128 offsetY = _mm_loadu_ps(sums.offsetY);
+    __m128 sumVX = _mm_loadu_ps(sums.sumVX);
+    __m128 sumVY = _mm_loadu_ps(sums.sumVY);
+    __m128 pushX = _mm_loadu_ps(sums.pushX);
+    __m128 pushY = _mm_loadu_ps(sums.pushY);
+    for (; j + LANES <= last; j += LANES) {
+        __m128 otherVX = _mm_loadu_ps(&velX[j]);
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(&posX[j]), ownX);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(&posY[j]), ownY);
+        __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 same = _mm_and_ps(_mm_cmplt_ps(d2, radius2Lanes), _mm_cmpgt_ps(_mm_mul_ps(otherVX, ownVX), zero));
+        __m128 close = _mm_cmplt_ps(d2, separation2Lanes);
+        flock = _mm_add_ps(flock, _mm_and_ps(same, one));
+        offsetX = _mm_add_ps(offsetX, _mm_and_ps(same, dx));
+        offsetY = _mm_add_ps(offsetY, _mm_and_ps(same, dy));
+        sumVX = _mm_add_ps(sumVX, _mm_and_ps(same, otherVX));
+        sumVY = _mm_add_ps(sumVY, _mm_and_ps(same, _mm_loadu_ps(&velY[j])));
+        pushX = _mm_sub_ps(pushX, _mm_and_ps(close, dx));
+        pushY = _mm_sub_ps(pushY, _mm_and_ps(close, dy));
+    }
+    _mm_storeu_ps(sums.flock, flock);
+    _mm_storeu_ps(sums.offsetX, offsetX);
+    _mm_storeu_ps(sums.offsetY, offsetY);
+    _mm_storeu_ps(sums.sumVX, sumVX);
+    _mm_storeu_ps(sums.sumVY, sumVY);
+    _mm_storeu_ps(sums.pushX, pushX);
+    _mm_storeu_ps(sums.pushY, pushY);
+#else
+    for (; j + LANES <= last; j += LANES) {
+        for (int lane = 0; lane < LANES; lane++) {
+            accumulateOne(j + lane, lane, x, y, vx, separation2, sums);
+        }
+    }
+#endif
+
+    for (; j < last; j++) {
+        accumulateOne(j, 0, x, y, vx, separation2, sums);
+    }
+}
+
+/**
+ * @brief Scalar form of one lane of accumulateRun()
+ */
+void FishSchool::accumulateOne(int j, int lane, float x, float y, float vx, float separation2, NeighbourSums& sums) const
+{
+    float dx = posX[j] - x;
+    float dy = posY[j] - y;
+    float d2 = dx * dx + dy * dy;
+    bool same = d2 < radius2 && velX[j] * vx > 0.0f;
+    bool close = d2 < separation2;
+    sums.flock[lane] += same ? 1.0f : 0.0f;
+    sums.offsetX[lane] += same ? dx : 0.0f;
+    sums.offsetY[lane] += same ? dy : 0.0f;
+    sums.sumVX[lane] += same ? velX[j] : 0.0f;
+    sums.sumVY[lane] += same ? velY[j] : 0.0f;
+    sums.pushX[lane] -= close ? dx : 0.0f;
+    sums.pushY[lane] -= close ? dy : 0.0f;
+}
+
+/**
+ * @brief Computes one fish's new velocity from its neighbours
+ * @details The fish itself passes every neighbour test and is taken back out afterwards,
+ * which keeps the neighbour loop free of index checks.
+ * @param fish Index in cell order
+ */
+void FishSchool::steerOne(int fish)
+{
+    const float y = posY[fish];
+    const float vx = velX[fish];
+    const float vy = velY[fish];
+
+    NeighbourSums sums = {};
+    int cx = cell[fish] % gridW;
+    int cy = cell[fish] / gridW;
+    int firstColumn = std::max(0, cx - 1);
+    int lastColumn = std::min(gridW - 1, cx + 1);
+    for (int row = std::max(0, cy - 1); row <= std::min(gridH - 1, cy + 1); row++) {
+        // Adjacent cells of a row are adjacent in cell order, so each row is one run
+        accumulateRun(cellStart[row * gridW + firstColumn], cellStart[row * gridW + lastColumn + 1], fish, sums);
+    }
+
+    for (int lane = 1; lane < LANES; lane++) {
+        sums.flock[0] += sums.flock[lane];
+        sums.offsetX[0] += sums.offsetX[lane];
+        sums.offsetY[0] += sums.offsetY[lane];
+        sums.sumVX[0] += sums.sumVX[lane];
+        sums.sumVY[0] += sums.sumVY[lane];
+        sums.pushX[0] += sums.pushX[lane];
+        sums.pushY[0] += sums.pushY[lane];
+    }
+    float neighbours = sums.flock[0] - 1.0f;
+
+    float ax = sums.pushX[0] / separationRadius * Game::SCHOOL_SEPARATION_WEIGHT;
+    float ay = sums.pushY[0] / separationRadius * Game::SCHOOL_SEPARATION_WEIGHT;
+    if (neighbours > 0.5f) {
+        float averageVX = (sums.sumVX[0] - vx) / neighbours;
+        float averageVY = (sums.sumVY[0] - vy) / neighbours;
+        ax += (averageVX - vx) * Game::SCHOOL_ALIGNMENT_WEIGHT + sums.offsetX[0] / neighbours / cellSize * Game::SCHOOL_COHESION_WEIGHT;
+        ay += (averageVY - vy) * Game::SCHOOL_ALIGNMENT_WEIGHT + sums.offsetY[0] / neighbours / cellSize * Game::SCHOOL_COHESION_WEIGHT;
+    }
+
+    // Keep to the water between the surface and the deepest the rod reaches
+    if (y < topY + edgeMargin) {
+        ay += edgePush;
+    } else if (y > bottomY - edgeMargin) {
+        ay -= edgePush;
+    }
+
+    float speedX = std::min(maxSpeed, std::max(minSpeed, std::fabs(vx + ax)));
+    float newVY = std::min(maxVerticalSpeed, std::max(-maxVerticalSpeed, vy + ay));
+    if ((y <= topY && newVY < 0.0f) || (y >= bottomY && newVY > 0.0f)) {
+        newVY = 0.0f;
+    }
+    steeredX[fish] = vx > 0.0f ? speedX : -speedX;
+    steeredY[fish] = newVY;
+}
@@ -0,0 +1,168 @@
+#include <algorithm> // For clamps
+#include <cmath> // For segment lengths
+
+#include "fishing_line.hpp" // Class header
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h> // For the 4-wide integration and constraint passes
+#define FISHING_LINE_SSE
+#endif
+
+namespace
+{
+    const float MIN_SEGMENT = 1e-4f; // Guards the length division when two points meet
+}
+
+/**
+ * @brief Lays the line out straight between the tip and the hook, at rest
+ * @param tip Rod tip
+ * @param hook Top of the hook
+ * @param metrics Round metrics, for the waterline and force scales
+ * @param maxReelSpeed Rod speed that counts as reeling at full speed
+ */
+void FishingLine::reset(const Vector2D& tip, const Vector2D& hook, const WorldMetrics& metrics, float maxReelSpeed)
+{
+    surfaceY = metrics.surfaceY;
+    gravity = Game::LINE_GRAVITY * metrics.heightScale;
+    sideScale = Game::LINE_FISH_PULL * metrics.widthScale;
+    reelSpeed = std::max(maxReelSpeed, MIN_SEGMENT);
+    minLength = std::max(metrics.rodRadiusY, 1.0f);
+    lastHookY = hook.y;
+
+    for (int k = 0; k < PADDED; k++) {
+        float along = static_cast<float>(k < SEGMENTS ? k : SEGMENTS) / SEGMENTS;
+        x[k] = prevX[k] = tip.x + (hook.x - tip.x) * along;
+        y[k] = prevY[k] = tip.y + (hook.y - tip.y) * along;
+        corrX[k] = 0.0f;
+        corrY[k] = 0.0f;
+    }
+}
+
+/**
+ * @brief Advances the line one tick
+ * @param tip Rod tip this tick
+ * @param hook Top of the hook this tick
+ * @param load 0 for a bare hook up to 1 for the heaviest catch; takes up slack and sinks the line
+ * @param sidePull -1 to 1, which way and how hard a hooked fish tugs
+ */
+void FishingLine::step(const Vector2D& tip, const Vector2D& hook, float load, float sidePull)
+{
+    float reelIn = std::min(std::max((lastHookY - hook.y) / reelSpeed, 0.0f), 1.0f);
+    lastHookY = hook.y;
+
+    float slack = Game::LINE_SLACK - 1.0f + Game::LINE_REEL_SLACK * reelIn;
+    slack *= 1.0f - std::min(std::max(load, 0.0f), 1.0f);
+    Vector2D span = hook - tip;
+    float length = std::max(std::sqrt(span.x * span.x + span.y * span.y), minLength);
+    float restLength = length * (1.0f + slack) / SEGMENTS;
+
+    integrate(sidePull * sideScale, load * Game::LINE_HAZARD_DRAG);
+    pin(tip, hook);
+    for (int pass = 0; pass < Game::LINE_ITERATIONS; pass++) {
+        relax(restLength);
+        pin(tip, hook);
+    }
+}
+
+/**
+ * @brief Copies the points, tip first
+ * @param out Receives POINTS positions
+ */
+void FishingLine::copyPoints(Vector2D* out) const
+{
+    for (int k = 0; k < POINTS; k++) {
+        out[k] = Vector2D(x[k], y[k]);
+    }
+}
+
+/**
+ * @brief Holds the ends in place; padding points sit on the hook so they stay finite
+ */
+void FishingLine::pin(const Vector2D& tip, const Vector2D& hook)
+{
+    x[0] = prevX[0] = tip.x;
+    y[0] = prevY[0] = tip.y;
+    for (int k = SEGMENTS; k < PADDED; k++) {
+        x[k] = prevX[k] = hook.x;
+        y[k] = prevY[k] = hook.y;
+    }
+}
+
+/**
+ * @brief Verlet step for every point: keep the damped velocity, add gravity and the sideways pull
+ * @param pull Horizontal acceleration
+ * @param drag Extra gravity, as a share of gravity
+ */
+void FishingLine::integrate(float pull, float drag)
+{
+    const float fall = gravity * (1.0f + drag);
+#ifdef FISHING_LINE_SSE
+    const __m128 surface = _mm_set1_ps(surfaceY);
+    const __m128 water = _mm_set1_ps(Game::LINE_WATER_DAMPING);
+    const __m128 air = _mm_set1_ps(Game::LINE_AIR_DAMPING);
+    const __m128 ax = _mm_set1_ps(pull);
+    const __m128 ay = _mm_set1_ps(fall);
+    for (int k = 0; k < PADDED; k += LANES) {
+        __m128 px = _mm_load_ps(x + k);
+        __m128 py = _mm_load_ps(y + k);
+        __m128 under = _mm_cmpgt_ps(py, surface);
+        __m128 damping = _mm_or_ps(_mm_and_ps(under, water), _mm_andnot_ps(under, air));
+        __m128 vx = _mm_mul_ps(_mm_sub_ps(px, _mm_load_ps(prevX + k)), damping);
+        __m128 vy = _mm_mul_ps(_mm_sub_ps(py, _mm_load_ps(prevY + k)), damping);
+        _mm_store_ps(prevX + k, px);
+        _mm_store_ps(prevY + k, py);
+        _mm_store_ps(x + k, _mm_add_ps(px, _mm_add_ps(vx, ax)));
+        _mm_store_ps(y + k, _mm_add_ps(py, _mm_add_ps(vy, ay)));
+    }
+#else
+    for (int k = 0; k < PADDED; k++) {
+        float damping = y[k] > surfaceY ? Game::LINE_WATER_DAMPING : Game::LINE_AIR_DAMPING;
+        float vx = (x[k] - prevX[k]) * damping;
+        float vy = (y[k] - prevY[k]) * damping;
+        prevX[k] = x[k];
+        prevY[k] = y[k];
+        x[k] += vx + pull;
+        y[k] += vy + fall;
+    }
+#endif
+}
+
+/**
+ * @brief One Jacobi pass: every segment moves both ends halfway back toward its rest length
+ * @param restLength Length of one segment
+ */
+void FishingLine::relax(float restLength)
+{
+#ifdef FISHING_LINE_SSE
+    const __m128 rest = _mm_set1_ps(restLength);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 minimum = _mm_set1_ps(MIN_SEGMENT);
+    for (int s = 0; s < SEGMENTS; s += LANES) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + s + 1), _mm_load_ps(x + s));
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + s + 1), _mm_load_ps(y + s));
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+        __m128 scale = _mm_div_ps(_mm_mul_ps(half, _mm_sub_ps(length, rest)), _mm_max_ps(length, minimum));
+        _mm_storeu_ps(corrX + s + 1, _mm_mul_ps(dx, scale));
+        _mm_storeu_ps(corrY + s + 1, _mm_mul_ps(dy, scale));
+    }
+    for (int k = 0; k < SEGMENTS; k += LANES) {
+        __m128 moveX = _mm_sub_ps(_mm_loadu_ps(corrX + k + 1), _mm_load_ps(corrX + k));
+        __m128 moveY = _mm_sub_ps(_mm_loadu_ps(corrY + k + 1), _mm_load_ps(corrY + k));
+        _mm_store_ps(x + k, _mm_add_ps(_mm_load_ps(x + k), moveX));
+        _mm_store_ps(y + k, _mm_add_ps(_mm_load_ps(y + k), moveY));
+    }
+#else
+    for (int s = 0; s < SEGMENTS; s++) {
+        float dx = x[s + 1] - x[s];
+        float dy = y[s + 1] - y[s];
+        float length = std::sqrt(dx * dx + dy * dy);
+        float scale = 0.5f * (length - restLength) / std::max(length, MIN_SEGMENT);
+        corrX[s + 1] = dx * scale;
+        corrY[s + 1] = dy * scale;
+    }
+    for (int k = 0; k < SEGMENTS; k++) {
+        x[k] += corrX[k + 1] - corrX[k];
+        y[k] += corrY[k + 1] - corrY[k];
+    }
+#endif
+}
@@ -17,20 +17,50 @@
 #include "heavy_hazard.hpp" // For heavy hazard class
 #include "shock_hazard.hpp" // For shock hazard class
 #include "game_constants.hpp" // For game values
-#include "scaling.hpp" // For scaling helper methods
+#include "bot.hpp" // For bot observations
+#include "level_config.hpp" // For level table
+#include "alloc_tracker.hpp" // For steady-state allocation checks
+#include "job_system.hpp" // For chunked floater updates
 
 using namespace std;
 
-FishingLogic::FishingLogic(int dayCount, int roundDuration, int rodLevel) : 
-    rod(Rod(1.0f + (rodLevel * 0.1f))), 
+/**
+ * @brief Creates the round for a campaign day using the shared level table
+ * @param dayCount Current day number (1+), days past the table are extrapolated
+ * @param roundDuration Round length in ms
+ * @param rodLevel Player rod upgrade level
+ * @param metrics Scaled sizes and limits for the current resolution
+ */
+FishingLogic::FishingLogic(int dayCount, int roundDuration, int rodLevel, const WorldMetrics& metrics) :
+    FishingLogic(LevelTable::global().getLevel(dayCount), roundDuration, rodLevel, metrics, isVictoryMode())
+{
+    cout << "Initialized fishing for day " << dayCount << endl;
+}
+
+/**
+ * @brief Creates a round from explicit level parameters
+ * @param level Spawn counts and hazard speed for the round
+ * @param roundDuration Round length in ms
+ * @param rodLevel Player rod upgrade level
+ * @param metrics Scaled sizes and limits for the current resolution, copied into the round
+ * @param isHazardFree Whether hazards should be disabled (victory mode)
+ * @param headless Run on a simulated clock with logging off (see advanceClock)
+ * @details Used directly by balance sweeps to run generated level variants without a table
+ */
+FishingLogic::FishingLogic(const LevelParams& level, int roundDuration, int rodLevel, const WorldMetrics& metrics,
+                           bool isHazardFree, bool headless) : 
+    metrics(metrics),
+    rod(Rod(1.0f + (rodLevel * 0.1f), metrics)), 
     roundStartTime(0), // Initialize to 0 instead of current time
     roundDuration(roundDuration), 
-    playerRodLevel(rodLevel)
+    playerRodLevel(rodLevel),
+    headless(headless),
+    rng(std::random_device()())
 {
     // Initialize scaled spawn locations
-    float surfacePond = Scale::scaleH(Visuals::SURFACE_POND_PERCENT);
-    float maxRodLength = Scale::scaleH(Game::ROD_MAX_LENGTH_PERCENT);
-    float heightScale = Scale::getHeightScaleFactor();
+    float surfacePond = metrics.surfaceY;
+    float maxRodLength = metrics.rodMaxY;
+    float heightScale = metrics.heightScale;
     spawnLocations = {
         surfacePond + (50 * heightScale),
         surfacePond + (130 * heightScale),
@@ -42,16 +72,13 @@ FishingLogic::FishingLogic(int dayCount, int roundDuration, int rodLevel) :
         maxRodLength
     };
 
-    // This is a terrible, hacky solution to implement victory mode without changing things other methods :D
-    bool isHazardFree = false;    
-    std::ifstream loanPaidFile("victory_flag.txt");
-    if (loanPaidFile.good()) {
-        isHazardFree = true;
-        loanPaidFile.close();
-    }
-    
-    // Initialize fish and hazards based on day count
-    initFishHazards(dayCount, isHazardFree);
+    // Initialize fish and hazards for the level
+    initFishHazards(level, isHazardFree);
+    snapshots.reserve(allFish.size(), hazards.size()); // Pools never grow after this
+    fishOffscreen.assign((allFish.size() + Game::FLOATER_CHUNK - 1) / Game::FLOATER_CHUNK, 0);
+    hazardOffscreen.assign((hazards.size() + Game::FLOATER_CHUNK - 1) / Game::FLOATER_CHUNK, 0);
+    school.reserve(allFish.size(), metrics);
+    line.reset(lineTip(), lineHook(), metrics, rod.getMaxVelocity());
     
     spawnInterval = 2000;
     lastSpawnTime = 0; // Initialize to 0 instead of current time
@@ -61,157 +88,28 @@ FishingLogic::FishingLogic(int dayCount, int roundDuration, int rodLevel) :
 }
 
 /**
- * @brief Initializes fish and hazards based on day-specific level configurations
- * @param dayCount Current day number (1-10+)
+ * @brief Checks for the victory mode flag file
+ * @return bool true if hazards should be disabled for this round
+ * @details This is a terrible, hacky solution to implement victory mode without changing things other methods :D
+ */
+bool FishingLogic::isVictoryMode()
+{
+    std::ifstream loanPaidFile("victory_flag.txt");
+    return loanPaidFile.good();
+}
+
+/**
+ * @brief Initializes fish and hazards from a level configuration
+ * @param level Spawn counts and hazard speed for the round
  * @param isHazardFree Whether hazards should be disabled (victory mode)
  */
-void FishingLogic::initFishHazards(int dayCount, bool isHazardFree) {
-    // Clamp to 1-10, 10 is max difficulty
-    int effectiveDay = std::max(1, std::min(dayCount, 10));
-    
-    cout << "Initializing fishing for day " << dayCount << " (clamped to " << effectiveDay << ")" << endl;
-    
-    int numSmallFish = 0;
-    int numMediumFish = 0;
-    int numBigFish = 0;
-    
-    int numNormalHazards = 0;
-    int numHeavyHazards = 0;
-    int numShockHazards = 0;
-    
-    float hazardSpeedMultiplier = 1.0f;
-    
-    // Determine the fish and hazard counts based on day
-    switch (effectiveDay) {
-        case 1:
-            numSmallFish = Level::Day1::SMALL_FISH;
-            numMediumFish = Level::Day1::MEDIUM_FISH;
-            numBigFish = Level::Day1::BIG_FISH;
-            
-            numNormalHazards = Level::Day1::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day1::HEAVY_HAZARDS;
-            numShockHazards = Level::Day1::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day1::HAZARD_SPEED_MULTIPLIER;
-            break;
-            
-        case 2:
-            numSmallFish = Level::Day2::SMALL_FISH;
-            numMediumFish = Level::Day2::MEDIUM_FISH;
-            numBigFish = Level::Day2::BIG_FISH;
-            
-            numNormalHazards = Level::Day2::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day2::HEAVY_HAZARDS;
-            numShockHazards = Level::Day2::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day2::HAZARD_SPEED_MULTIPLIER;
-            break;
-            
-        case 3:
-            numSmallFish = Level::Day3::SMALL_FISH;
-            numMediumFish = Level::Day3::MEDIUM_FISH;
-            numBigFish = Level::Day3::BIG_FISH;
-            
-            numNormalHazards = Level::Day3::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day3::HEAVY_HAZARDS;
-            numShockHazards = Level::Day3::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day3::HAZARD_SPEED_MULTIPLIER;
-            break;
-            
-        case 4:
-            numSmallFish = Level::Day4::SMALL_FISH;
-            numMediumFish = Level::Day4::MEDIUM_FISH;
-            numBigFish = Level::Day4::BIG_FISH;
-            
-            numNormalHazards = Level::Day4::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day4::HEAVY_HAZARDS;
-            numShockHazards = Level::Day4::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day4::HAZARD_SPEED_MULTIPLIER;
-            break;
-            
-        case 5:
-            numSmallFish = Level::Day5::SMALL_FISH;
-            numMediumFish = Level::Day5::MEDIUM_FISH;
-            numBigFish = Level::Day5::BIG_FISH;
-            
-            numNormalHazards = Level::Day5::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day5::HEAVY_HAZARDS;
-            numShockHazards = Level::Day5::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day5::HAZARD_SPEED_MULTIPLIER;
-            break;
-            
-        case 6:
-            numSmallFish = Level::Day6::SMALL_FISH;
-            numMediumFish = Level::Day6::MEDIUM_FISH;
-            numBigFish = Level::Day6::BIG_FISH;
-            
-            numNormalHazards = Level::Day6::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day6::HEAVY_HAZARDS;
-            numShockHazards = Level::Day6::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day6::HAZARD_SPEED_MULTIPLIER;
-            break;
-            
-        case 7:
-            numSmallFish = Level::Day7::SMALL_FISH;
-            numMediumFish = Level::Day7::MEDIUM_FISH;
-            numBigFish = Level::Day7::BIG_FISH;
-            
-            numNormalHazards = Level::Day7::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day7::HEAVY_HAZARDS;
-            numShockHazards = Level::Day7::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day7::HAZARD_SPEED_MULTIPLIER;
-            break;
-            
-        case 8:
-            numSmallFish = Level::Day8::SMALL_FISH;
-            numMediumFish = Level::Day8::MEDIUM_FISH;
-            numBigFish = Level::Day8::BIG_FISH;
-            
-            numNormalHazards = Level::Day8::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day8::HEAVY_HAZARDS;
-            numShockHazards = Level::Day8::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day8::HAZARD_SPEED_MULTIPLIER;
-            break;
-            
-        case 9:
-            numSmallFish = Level::Day9::SMALL_FISH;
-            numMediumFish = Level::Day9::MEDIUM_FISH;
-            numBigFish = Level::Day9::BIG_FISH;
-            
-            numNormalHazards = Level::Day9::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day9::HEAVY_HAZARDS;
-            numShockHazards = Level::Day9::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day9::HAZARD_SPEED_MULTIPLIER;
-            break;
-            
-        case 10:
-        default:
-            numSmallFish = Level::Day10::SMALL_FISH;
-            numMediumFish = Level::Day10::MEDIUM_FISH;
-            numBigFish = Level::Day10::BIG_FISH;
-            
-            numNormalHazards = Level::Day10::NORMAL_HAZARDS;
-            numHeavyHazards = Level::Day10::HEAVY_HAZARDS;
-            numShockHazards = Level::Day10::SHOCK_HAZARDS;
-            
-            hazardSpeedMultiplier = Level::Day10::HAZARD_SPEED_MULTIPLIER;
-            break;
-    }
-    
-    initFish(numSmallFish, numMediumFish, numBigFish); // Initialize hazards with the determined counts
+void FishingLogic::initFishHazards(const LevelParams& level, bool isHazardFree) {
+    initFish(level.smallFish, level.mediumFish, level.bigFish);
     if (isHazardFree) { // Skip hazard spawning if in victory mode
-        cout << "Creating hazard-free fishing round!" << endl;
+        if (!headless) cout << "Creating hazard-free fishing round!" << endl;
         return;
     }
-    initHazards(numNormalHazards, numHeavyHazards, numShockHazards, hazardSpeedMultiplier); // Initialize hazards with the determined counts
-
+    initHazards(level.normalHazards, level.heavyHazards, level.shockHazards, level.hazardSpeedMultiplier);
 }
 
 /**
@@ -222,29 +120,34 @@ void FishingLogic::initFishHazards(int dayCount, bool isHazardFree) {
  */
 int FishingLogic::calculateRandNum(int lower, int upper)
 {
-    // create random seed
-    std::random_device random_seed;
-    // create random engine/generator
-    std::default_random_engine gen(random_seed());
     // use distribution to simulate choice for angle (0 to 45)
     std::uniform_int_distribution<int> distribution(lower,upper);
-    int randNum = distribution(gen);
+    int randNum = distribution(rng);
     return randNum;
 }
 
+/**
+ * @brief Reseeds the round's random generator
+ * @param seed Seed value, same seed and inputs replay the same round in headless mode
+ */
+void FishingLogic::seedRandom(unsigned int seed)
+{
+    rng.seed(seed);
+}
+
 /**
  * @brief Randomizes the speed of a fish within bounds based on size and window size
- * @param fishPtr fish reference
+ * @param fish Fish to pick a speed for
  * @return float randomized speed value
  */
-float FishingLogic::calculateRandSpeed(std::shared_ptr<Fish>& fishPtr)
+float FishingLogic::calculateRandSpeed(const Fish& fish)
 {
-    float speedScale = Scale::getWidthScaleFactor();
+    float speedScale = metrics.widthScale;
 
-    if(dynamic_cast<MediumFish*>(fishPtr.get()) != nullptr)
+    if (fish.getKind() == FloaterKind::MEDIUM_FISH)
     {
         return speedScale * (float)calculateRandNum(Game::MAX_MEDIUM_FISH_SPEED - 2, Game::MAX_MEDIUM_FISH_SPEED);
-    } else if(dynamic_cast<BigFish*>(fishPtr.get()) != nullptr)
+    } else if (fish.getKind() == FloaterKind::BIG_FISH)
     {
         return speedScale * (float)calculateRandNum(Game::MAX_BIG_FISH_SPEED - 2, Game::MAX_BIG_FISH_SPEED);
     } else
@@ -258,7 +161,7 @@ float FishingLogic::calculateRandSpeed(std::shared_ptr<Fish>& fishPtr)
  * @return reference to fish vector
  * @details Fish vector will get more expensive to store/send as more fish added so return ref
  */
-std::vector<std::shared_ptr<Fish>>& FishingLogic::getAllFishRef()
+FloaterPool<Fish>& FishingLogic::getAllFishRef()
 {
     return allFish;
 }
@@ -268,7 +171,7 @@ std::vector<std::shared_ptr<Fish>>& FishingLogic::getAllFishRef()
  * @return reference to hazard vector
  * @details Hazard vector will get more expensive to store/send as more fish added so return ref
  */
-std::vector<std::shared_ptr<Hazard>>& FishingLogic::getHazardsRef()
+FloaterPool<Hazard>& FishingLogic::getHazardsRef()
 {
     return hazards;
 }
@@ -295,10 +198,10 @@ void FishingLogic::handleUserInput(UserInput::Action userInput)
     // Check for released fish
     if (userInput == UserInput::Action::RELEASE) 
     {   
-        if (caughtFishPtr) {
+        if (hookedFish()) {
             releaseFish();
         }
-        else if (caughtHeavyHazardPtr) {
+        else if (hookedHeavyHazard()) {
             releaseHeavyHazard();
         }
     }
@@ -313,11 +216,14 @@ void FishingLogic::handleUserInput(UserInput::Action userInput)
         return;
     }
     
+    Fish* caughtFishPtr = hookedFish();
+    Hazard* caughtHeavyHazardPtr = hookedHeavyHazard();
+
     // Get the current rod speed w/ heavy hazard multiplier
     float currentRodSpeed = rod.getMaxVelocity();
     if (caughtHeavyHazardPtr) {
         // Apply the heavy hazard's speed reduction when it's caught
-        auto heavyHazard = dynamic_cast<HeavyHazard*>(caughtHeavyHazardPtr.get());
+        auto heavyHazard = dynamic_cast<HeavyHazard*>(caughtHeavyHazardPtr);
         if (heavyHazard) {
             currentRodSpeed *= heavyHazard->getSlowFactor();
         }
@@ -336,16 +242,16 @@ void FishingLogic::handleUserInput(UserInput::Action userInput)
             // If reeling a fish or heavy hazard, match its motion to the rod
             if (caughtFishPtr) {
                 // Get the current speed magnitude and direction from the rod
-                float speedMagnitude = rod.getSpeed()[1];
-                float sameX = caughtFishPtr->getDirection()[0];
-                caughtFishPtr->setDirection(sameX, rod.getDirection()[1]);
+                float speedMagnitude = rod.getSpeed().y;
+                float sameX = caughtFishPtr->getDirection().x;
+                caughtFishPtr->setDirection(sameX, rod.getDirection().y);
                 caughtFishPtr->setSpeed(0, speedMagnitude);
             }
             else if (caughtHeavyHazardPtr) {
                 // Get the current speed magnitude and direction from the rod
-                float speedMagnitude = rod.getSpeed()[1];
-                float sameX = caughtHeavyHazardPtr->getDirection()[0];
-                caughtHeavyHazardPtr->setDirection(sameX, rod.getDirection()[1]);
+                float speedMagnitude = rod.getSpeed().y;
+                float sameX = caughtHeavyHazardPtr->getDirection().x;
+                caughtHeavyHazardPtr->setDirection(sameX, rod.getDirection().y);
                 caughtHeavyHazardPtr->setSpeed(0, speedMagnitude);
             }
             break;
@@ -360,16 +266,16 @@ void FishingLogic::handleUserInput(UserInput::Action userInput)
             
             if (caughtFishPtr) {
                 // Get the current speed magnitude and direction from the rod
-                float speedMagnitude = rod.getSpeed()[1];
-                float sameX = caughtFishPtr->getDirection()[0];
-                caughtFishPtr->setDirection(sameX, rod.getDirection()[1]);
+                float speedMagnitude = rod.getSpeed().y;
+                float sameX = caughtFishPtr->getDirection().x;
+                caughtFishPtr->setDirection(sameX, rod.getDirection().y);
                 caughtFishPtr->setSpeed(0, speedMagnitude);
             }
             else if (caughtHeavyHazardPtr) {
                 // Get the current speed magnitude and direction from the rod
-                float speedMagnitude = rod.getSpeed()[1];
-                float sameX = caughtHeavyHazardPtr->getDirection()[0];
-                caughtHeavyHazardPtr->setDirection(sameX, rod.getDirection()[1]);
+                float speedMagnitude = rod.getSpeed().y;
+                float sameX = caughtHeavyHazardPtr->getDirection().x;
+                caughtHeavyHazardPtr->setDirection(sameX, rod.getDirection().y);
                 caughtHeavyHazardPtr->setSpeed(0, speedMagnitude);
             }
             break;
@@ -404,25 +310,32 @@ float FishingLogic::randomizeDir()
  */
 void FishingLogic::spawnNewFloaters()
 {
+    if (allFish.empty()) {
+        return;
+    }
+
     // Determine how many total fish can be activated (allowed on screen) this cycle
     int numFishActivated = calculateRandNum(1,allFish.size());
     // Debug
-    cout << "num fish total: " << allFish.size() << endl;
-    cout << "num fish activated: " << numFishActivated << endl;
+    if (!headless) {
+        cout << "num fish total: " << allFish.size() << endl;
+        cout << "num fish activated: " << numFishActivated << endl;
+    }
     while (numFishActivated > 0) {
         int randi = calculateRandNum(0, allFish.size() - 1);
-        cout << "random fish spawned: " << randi << endl;
+        if (!headless) cout << "random fish spawned: " << randi << endl;
         // if randomly selected fish is not already active, spawn it
         if (!allFish[randi]->isActive()) {
-            float surfacePond = Scale::scaleH(Visuals::SURFACE_POND_PERCENT);
-            float maxLength = Scale::scaleW(Game::ROD_MAX_LENGTH_PERCENT);
+            allFish.respawn(randi); // Old handles to this slot go stale
+            float surfacePond = metrics.surfaceY;
+            float maxLength = metrics.rodMaxY;
 
-            int randY = calculateRandNum(surfacePond + 10, maxLength - (int)allFish[randi]->getDimens()[1]);
+            int randY = calculateRandNum(surfacePond + 10, maxLength - (int)allFish[randi]->getDimens().y);
             float randDir = randomizeDir();
             allFish[randi]->setDirection(randDir, 1);
             // set start x pos based on dir of fish
-            randDir > 0 ? allFish[randi]->setPosition(0,randY) : allFish[randi]->setPosition(Dimens::SCREEN_W - (int)allFish[randi]->getDimens()[0],randY);
-            allFish[randi]->setSpeed(calculateRandSpeed(allFish[randi]),0);
+            randDir > 0 ? allFish[randi]->setPosition(0,randY) : allFish[randi]->setPosition(metrics.screenW - (int)allFish[randi]->getDimens().x,randY);
+            allFish[randi]->setSpeed(calculateRandSpeed(*allFish[randi]),0);
             allFish[randi]->setActive(true);
         }
         // either way activated fish has been spawned
@@ -446,21 +359,23 @@ void FishingLogic::spawnHazards()
         int randi = calculateRandNum(0, hazards.size() - 1);
         // if randomly selected hazard is not already active, spawn it
         if (!hazards[randi]->isActive()) {
+            hazards.respawn(randi); // Old handles to this slot go stale
+
             // Scale spawn position and size
         
-            float surfacePond = Scale::scaleH(Visuals::SURFACE_POND_PERCENT);
-            float maxLength = Scale::scaleH(Game::ROD_MAX_LENGTH_PERCENT);
+            float surfacePond = metrics.surfaceY;
+            float maxLength = metrics.rodMaxY;
 
             float hazardH, hazardW;
             if (dynamic_cast<ShockHazard*>(hazards[randi].get())) {
-                hazardH = Scale::scaleH(Visuals::SHOCK_HAZARD_HEIGHT_PERCENT);
-                hazardW = Scale::scaleW(Visuals::SHOCK_HAZARD_WIDTH_PERCENT);
+                hazardH = metrics.shockHazardH;
+                hazardW = metrics.shockHazardW;
             } else if (dynamic_cast<HeavyHazard*>(hazards[randi].get())) {
-                hazardH = Scale::scaleH(Visuals::HEAVY_HAZARD_HEIGHT_PERCENT);
-                hazardW = Scale::scaleW(Visuals::HEAVY_HAZARD_WIDTH_PERCENT);
+                hazardH = metrics.heavyHazardH;
+                hazardW = metrics.heavyHazardW;
             } else {
-                hazardH = Scale::scaleH(Visuals::HAZARD_HEIGHT_PERCENT);
-                hazardW = Scale::scaleW(Visuals::HAZARD_WIDTH_PERCENT);
+                hazardH = metrics.hazardH;
+                hazardW = metrics.hazardW;
             }
 
             int randY = calculateRandNum(surfacePond + 10, maxLength - (int)hazardH);
@@ -468,14 +383,14 @@ void FishingLogic::spawnHazards()
 
             // Check direction of hazard movement to adjust spawn x position
             if (randDir < 0) {  // Spawn off right side
-                hazards[randi]->setPosition(Dimens::SCREEN_W, randY);
+                hazards[randi]->setPosition(metrics.screenW, randY);
                 hazards[randi]->setDirection(randDir, 0); // Move left
             } else {
                 hazards[randi]->setPosition(-hazardW, randY);   // Spawn off left side
                 hazards[randi]->setDirection(randDir, 0); // Move right
             }
 
-            hazards[randi]->setSpeed(Game::MAX_HAZARD_SPEED * Scale::getWidthScaleFactor(),0);
+            hazards[randi]->setSpeed(metrics.hazardSpeed,0);
             // Activate hazard
             hazards[randi]->setActive(true);
         }
@@ -494,34 +409,33 @@ void FishingLogic::spawnHazards()
 void FishingLogic::initHazards(int numNormalHazards, int numHeavyHazards, int numShockHazards, float speedMultiplier)
 {
     // Base hazard speed with multiplier applied
-    float hazardSpeed = Game::MAX_HAZARD_SPEED * Scale::getWidthScaleFactor() * speedMultiplier;
+    float hazardSpeed = metrics.hazardSpeed * speedMultiplier;
     
-    cout << "Initializing hazards: " << numNormalHazards << " normal, " 
-         << numHeavyHazards << " heavy, " << numShockHazards 
-         << " shock with speed multiplier " << speedMultiplier << endl;
+    if (!headless) {
+        cout << "Initializing hazards: " << numNormalHazards << " normal, " 
+             << numHeavyHazards << " heavy, " << numShockHazards 
+             << " shock with speed multiplier " << speedMultiplier << endl;
+    }
     
     // Create normal hazards
     for (int i = 0; i < numNormalHazards; i++) {
-        float hazardW = Scale::scaleW(Visuals::HAZARD_WIDTH_PERCENT);
-        float hazardH = Scale::scaleH(Visuals::HAZARD_HEIGHT_PERCENT);
-        auto hazard = std::make_shared<Hazard>(hazardW, hazardH, hazardSpeed);
-        hazards.push_back(hazard);
+        float hazardW = metrics.hazardW;
+        float hazardH = metrics.hazardH;
+        hazards.add(std::unique_ptr<Hazard>(new Hazard(hazardW, hazardH, hazardSpeed)));
     }
     
     // Create heavy hazards
     for (int i = 0; i < numHeavyHazards; i++) {
-        float heavyHazardW = Scale::scaleW(Visuals::HEAVY_HAZARD_WIDTH_PERCENT);
-        float heavyHazardH = Scale::scaleH(Visuals::HEAVY_HAZARD_HEIGHT_PERCENT);
-        auto hazard = std::make_shared<HeavyHazard>(heavyHazardW, heavyHazardH, hazardSpeed);
-        hazards.push_back(hazard);
+        float heavyHazardW = metrics.heavyHazardW;
+        float heavyHazardH = metrics.heavyHazardH;
+        hazards.add(std::unique_ptr<Hazard>(new HeavyHazard(heavyHazardW, heavyHazardH, hazardSpeed)));
     }
     
     // Create shock hazards
     for (int i = 0; i < numShockHazards; i++) {
-        float shockHazardW = Scale::scaleW(Visuals::SHOCK_HAZARD_WIDTH_PERCENT);
-        float shockHazardH = Scale::scaleH(Visuals::SHOCK_HAZARD_HEIGHT_PERCENT);
-        auto hazard = std::make_shared<ShockHazard>(shockHazardW, shockHazardH, hazardSpeed);
-        hazards.push_back(hazard);
+        float shockHazardW = metrics.shockHazardW;
+        float shockHazardH = metrics.shockHazardH;
+        hazards.add(std::unique_ptr<Hazard>(new ShockHazard(shockHazardW, shockHazardH, hazardSpeed)));
     }
 }
 
@@ -534,37 +448,39 @@ void FishingLogic::initHazards(int numNormalHazards, int numHeavyHazards, int nu
 void FishingLogic::initFish(int numSmallFish, int numMedFish, int numBigFish)
 {
     // Scale fish dimensions
-    float smallFishW = Scale::scaleW(Visuals::FISH_WIDTH_PERCENT);
-    float smallFishH = Scale::scaleH(Visuals::FISH_HEIGHT_PERCENT);
-    float smallFishSpeed = Game::MAX_FISH_SPEED * Scale::getWidthScaleFactor();
+    float smallFishW = metrics.fishW;
+    float smallFishH = metrics.fishH;
+    float smallFishSpeed = metrics.fishSpeed;
 
-    float medFishW = Scale::scaleW(Visuals::MEDIUM_FISH_WIDTH_PERCENT);
-    float medFishH = Scale::scaleH(Visuals::MEDIUM_FISH_HEIGHT_PERCENT);
-    float medFishSpeed = Game::MAX_MEDIUM_FISH_SPEED * Scale::getWidthScaleFactor();
+    float medFishW = metrics.mediumFishW;
+    float medFishH = metrics.mediumFishH;
+    float medFishSpeed = metrics.mediumFishSpeed;
 
-    float bigFishW = Scale::scaleW(Visuals::BIG_FISH_WIDTH_PERCENT);
-    float bigFishH = Scale::scaleH(Visuals::BIG_FISH_HEIGHT_PERCENT);
-    float bigFishSpeed = Game::MAX_BIG_FISH_SPEED * Scale::getWidthScaleFactor();
+    float bigFishW = metrics.bigFishW;
+    float bigFishH = metrics.bigFishH;
+    float bigFishSpeed = metrics.bigFishSpeed;
 
-    cout << "Initializing fish: " << numSmallFish << " small, " 
-         << numMedFish << " medium, " << numBigFish << " big" << endl;
+    if (!headless) {
+        cout << "Initializing fish: " << numSmallFish << " small, " 
+             << numMedFish << " medium, " << numBigFish << " big" << endl;
+    }
 
     int totalFish = numSmallFish + numMedFish + numBigFish;
     while (totalFish > 0)
     {
         if (numSmallFish > 0)
         {
-            allFish.push_back(std::make_shared<Fish>(smallFishW, smallFishH, smallFishSpeed));
+            allFish.add(std::unique_ptr<Fish>(new Fish(smallFishW, smallFishH, smallFishSpeed)));
             numSmallFish--;
         }
         else if (numMedFish > 0)
         {
-            allFish.push_back(std::make_shared<MediumFish>(medFishW, medFishH, medFishSpeed));
+            allFish.add(std::unique_ptr<Fish>(new MediumFish(medFishW, medFishH, medFishSpeed)));
             numMedFish--;
         }
         else if (numBigFish > 0)
         {
-            allFish.push_back(std::make_shared<BigFish>(bigFishW, bigFishH, bigFishSpeed));
+            allFish.add(std::unique_ptr<Fish>(new BigFish(bigFishW, bigFishH, bigFishSpeed)));
             numBigFish--;
         }
         // recalculate total fish
@@ -574,78 +490,165 @@ void FishingLogic::initFish(int numSmallFish, int numMedFish, int numBigFish)
 
 /**
  * @brief tests if a floater has intersected the rod
- * @param floaterDetails Vector with floater location and size
- * @return bool true if intersection, false if not
+ * @param floater Fish or hazard to test
+ * @return bool true if intersection (and the rod can hook it), false if not
  */
-bool FishingLogic::checkFloaterCaught(const std::vector<Vector2D>& floaterDetails) {
-    //std::cout << "Checked floater caught" << std::endl;
-    int floaterX = floaterDetails[0][0];
-    int floaterY = floaterDetails[0][1];
-    int floaterW = floaterDetails[3][0];
-    int floaterH = floaterDetails[3][1];
+bool FishingLogic::checkFloaterCaught(const Floater& floater) const {
+    Vector2D floaterPos = floater.getPosition();
+    Vector2D floaterDimens = floater.getDimens();
+    int floaterX = floaterPos.x;
+    int floaterY = floaterPos.y;
+    int floaterW = floaterDimens.x;
+    int floaterH = floaterDimens.y;
 
     // Create hitbox at fish's mouth
     int hitboxSize = floaterH / 2;
     int hitboxX, hitboxY;
-    if (floaterDetails[1][0] > 0) {
+    if (floater.getDirection().x > 0) {
         hitboxX = floaterX + floaterW - hitboxSize - 5;
     } else {
         hitboxX = floaterX + 5;
     }
     hitboxY = floaterY + (floaterH - hitboxSize) / 2;
 
-    int rodX = rod.getPosition()[0];
-    int rodY = rod.getPosition()[1];
+    Vector2D rodPos = rod.getPosition();
+    int rodX = rodPos.x;
+    int rodY = rodPos.y;
 
-    int rodRX = Scale::scaleW(Game::ROD_RADIUSX_PERCENT) * 1.2f; // slightly bigger rod hitbox than visual
-    int rodRY = Scale::scaleH(Game::ROD_RADIUSY_PERCENT) * 1.2f;
+    int rodRX = metrics.rodHitRadiusX; // slightly bigger rod hitbox than visual
+    int rodRY = metrics.rodHitRadiusY;
 
     if ((rodY + rodRY > hitboxY) && (rodY - rodRY < hitboxY + hitboxSize)) {
         if ((hitboxX + hitboxSize > rodX - rodRX) && (hitboxX < rodX + rodRX)) {
-            // Check if this is a fish (not a hazard)
-            for (auto& fish : allFish) {
-                if (fish->isActive() && 
-                    fish->getPosition()[0] == floaterDetails[0][0] && 
-                    fish->getPosition()[1] == floaterDetails[0][1]) {
-                    // Check fish type against rod level
-                    if (dynamic_cast<MediumFish*>(fish.get()) && playerRodLevel < 2) {
-                        return false;
-                    }
-                    if (dynamic_cast<BigFish*>(fish.get()) && playerRodLevel < 4) {
-                        return false;
-                    }
-                    return true;
-                }
-            }
-            return true; // For hazards or untyped floaters
+            // Check fish type against rod level (hazards always hook)
+            return canCatch(floater.getKind(), playerRodLevel);
         }
     }
     return false;
 }
 
+/**
+ * @brief Whether a rod of the given level can hook a floater kind
+ * @param kind Floater kind
+ * @param rodLevel Player rod upgrade level
+ * @return bool false for fish too big for the rod; hazards always hook
+ */
+bool FishingLogic::canCatch(FloaterKind kind, int rodLevel)
+{
+    switch (kind)
+    {
+        case FloaterKind::MEDIUM_FISH:
+            return rodLevel >= 2;
+        case FloaterKind::BIG_FISH:
+            return rodLevel >= 4;
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief Copies the state a bot needs into an observation
+ * @param out Observation to fill; its floater vectors are reused between ticks
+ */
+void FishingLogic::observe(BotObservation& out) const
+{
+    out.rodPosition = rod.getPosition();
+    out.rodHalfWidth = metrics.rodRadiusX;
+    out.rodHalfHeight = metrics.rodRadiusY;
+    out.rodSpeed = rod.getMaxVelocity();
+    if (hookedHeavyHazard()) {
+        out.rodSpeed *= Game::HEAVY_HAZARD_SLOW_FACTOR;
+    }
+    out.rodMinY = metrics.rodMinY;
+    out.rodMaxY = metrics.rodMaxY;
+    out.surfaceY = metrics.surfaceY;
+    out.stunned = stunned;
+    out.fishHooked = hasCaughtFish();
+    out.heavyHazardHooked = hasCaughtHeavyHazard();
+    out.rodLevel = playerRodLevel;
+
+    out.fish.clear();
+    for (const auto& fish : allFish) {
+        if (fish->isActive() && !fish->isCaught()) {
+            out.fish.push_back({fish->getKind(), fish->getPosition(), fish->getDirection() * fish->getSpeed(), fish->getDimens()});
+        }
+    }
+    out.hazards.clear();
+    for (const auto& hazard : hazards) {
+        if (hazard->isActive() && !hazard->isCaught()) {
+            out.hazards.push_back({hazard->getKind(), hazard->getPosition(), hazard->getDirection() * hazard->getSpeed(), hazard->getDimens()});
+        }
+    }
+}
+
+/**
+ * @brief Copies the state a view needs to draw this round
+ * @param out Snapshot to fill; its vectors are reused
+ */
+void FishingLogic::writeSnapshot(FishingSnapshot& out) const
+{
+    out.tick = tickCount;
+    out.rodPosition = rod.getPosition();
+    line.copyPoints(out.linePoints);
+    out.running = running;
+    out.paused = paused;
+    out.stunned = stunned;
+    out.catchScore = catchScore;
+    out.elapsedTime = elapsedTime;
+    out.roundDuration = roundDuration;
+    out.events = events;
+
+    out.fish.clear();
+    for (const auto& fish : allFish) {
+        if (fish->isActive()) {
+            out.fish.push_back({fish->getKind(), fish->getPosition(), fish->getDimens(),
+                                fish->getDirection().x > 0, fish->isCaught()});
+        }
+    }
+    out.hazards.clear();
+    for (const auto& hazard : hazards) {
+        if (hazard->isActive()) {
+            out.hazards.push_back({hazard->getKind(), hazard->getPosition(), hazard->getDimens(),
+                                   hazard->getDirection().x > 0, hazard->isCaught()});
+        }
+    }
+}
+
+/**
+ * @brief Finds the first active fish touching the rod that the rod can hook
+ * @return FloaterHandle handle to the fish, null if none
+ */
+FloaterHandle FishingLogic::findFishCollision() const
+{
+    for (size_t i = 0; i < allFish.size(); i++) {
+        if (allFish[i]->isActive() && !allFish[i]->isCaught() && checkFloaterCaught(*allFish[i])) {
+            return allFish.handleAt(i);
+        }
+    }
+    return FloaterHandle();
+}
+
 /**
  * @brief handles logic when a rod intersects fish or hazard
  */
 void FishingLogic::handleCatch()
 {
-    //std::cout << "Handling catch" << std::endl;
-    for (int i = 0; i < allFish.size(); i++)
-    {
-        if ((!caughtFishPtr) && (allFish[i]->isActive()))
-        {
-            std::vector<Vector2D> fishDetails = {allFish[i]->getPosition(), allFish[i]->getDirection(), allFish[i]->getSpeed(), allFish[i]->getDimens()};
-            // check if catch target on fish collides with rod
-            if (checkFloaterCaught(fishDetails)){
-                caughtFishPtr = allFish[i];
-                caughtFishPtr->setCaught(true);
-                // rotate fish by inverting height and width
-                float oldH = caughtFishPtr->getDimens()[1];
-                float oldW = caughtFishPtr->getDimens()[0];
-                caughtFishPtr->setDimens(oldH, oldW);
-                // set fish x (top right corner) to rod x depending on direction of swimming
-                float middleOfFish = caughtFishPtr->getDimens()[0]/2;
-                caughtFishPtr->setPosition(rod.getPosition()[0] + middleOfFish, rod.getPosition()[1]);
-            }
+    AllocZone allocZone("FishingLogic::handleCatch");
+
+    // Hook the first fish touching the rod if nothing is on the line yet
+    if (!hookedFish()) {
+        FloaterHandle hit = findFishCollision();
+        if (Fish* caughtFishPtr = allFish.get(hit)) {
+            caughtFish = hit;
+            caughtFishPtr->setCaught(true);
+            // rotate fish by inverting height and width
+            float oldH = caughtFishPtr->getDimens().y;
+            float oldW = caughtFishPtr->getDimens().x;
+            caughtFishPtr->setDimens(oldH, oldW);
+            // set fish x (top right corner) to rod x depending on direction of swimming
+            float middleOfFish = caughtFishPtr->getDimens().x/2;
+            caughtFishPtr->setPosition(rod.getPosition().x + middleOfFish, rod.getPosition().y);
+            events.push(FishingEventType::HOOKED, rod.getPosition());
         }
     }
 
@@ -654,46 +657,50 @@ void FishingLogic::handleCatch()
     {
         if (hazards[i]->isActive())
         {
-            std::vector<Vector2D> hazardDetails = {hazards[i]->getPosition(), hazards[i]->getDirection(), hazards[i]->getSpeed(), hazards[i]->getDimens()};
-            if (checkFloaterCaught(hazardDetails))
+            if (checkFloaterCaught(*hazards[i]))
             {
                 //Behavior for knocking fish off of hook when hitting a hazard
-                if (caughtFishPtr)
+                if (hookedFish())
                 {
                     releaseFish();
                 }
                 catchScore = std::max(0, catchScore - 2);
+                Vector2D hazardCenter = hazards[i]->getPosition() + hazards[i]->getDimens() * 0.5f;
 
                 if (auto hh = dynamic_cast<HeavyHazard*>(hazards[i].get()))
                 {
-                    caughtHeavyHazardPtr = hazards[i];
+                    caughtHeavyHazard = hazards.handleAt(i);
+                    Hazard* caughtHeavyHazardPtr = hookedHeavyHazard();
                     caughtHeavyHazardPtr->setCaught(true);
                     
                     // Speed reduction
                     float reducedSpeed = rod.getMaxVelocity() * hh->getSlowFactor();
-                    caughtHeavyHazardPtr->setSpeed(0, reducedSpeed * rod.getDirection()[1]);
+                    caughtHeavyHazardPtr->setSpeed(0, reducedSpeed * rod.getDirection().y);
                     caughtHeavyHazardPtr->setDirection(rod.getDirection());
                     
                     // Set rod velocity to match new speed if moving
-                    if (rod.getDirection()[1] < 0) {
+                    if (rod.getDirection().y < 0) {
                         rod.castUpSpeed(reducedSpeed);
-                    } else if (rod.getDirection()[1] > 0) {
+                    } else if (rod.getDirection().y > 0) {
                         rod.castDownSpeed(reducedSpeed);
                     }
+                    events.push(FishingEventType::HAZARD_HIT, hazardCenter);
                 }
                 else if (auto sh = dynamic_cast<ShockHazard*>(hazards[i].get()))
                 {
                     hazards[i]->setActive(false);
                     hazards[i]->setPosition(-100, -100);
-                    float minRod = Scale::scaleH(Game::ROD_MIN_LENGTH_PERCENT);
-                    rod.setPosition(rod.getPosition()[0], minRod);
+                    float minRod = metrics.rodMinY;
+                    rod.setPosition(rod.getPosition().x, minRod);
                     stunned = true;
-                    stunEndTime = SDL_GetTicks() + 2000;
+                    stunEndTime = getTicks() + 2000;
+                    events.push(FishingEventType::STUNNED, hazardCenter);
                 }
                 else
                 {
                     hazards[i]->setActive(false);
                     hazards[i]->setPosition(-100, -100);
+                    events.push(FishingEventType::HAZARD_HIT, hazardCenter);
                 }
                 
             }
@@ -705,73 +712,113 @@ void FishingLogic::handleCatch()
  * @brief Handles logic when a fish is released from the rod
  */
 void FishingLogic::releaseFish()
-{   // stop vertical speed
-    caughtFishPtr->setSpeed(calculateRandSpeed(caughtFishPtr), 0);
+{
+    Fish* caughtFishPtr = hookedFish();
+    if (!caughtFishPtr) {
+        return;
+    }
+    // stop vertical speed
+    caughtFishPtr->setSpeed(calculateRandSpeed(*caughtFishPtr), 0);
     caughtFishPtr->setCaught(false);
-    float surfacePond = Scale::scaleH(Visuals::SURFACE_POND_PERCENT);
-    float rodH = Scale::scaleH(Game::ROD_RADIUSY_PERCENT);
+    float surfacePond = metrics.surfaceY;
+    float rodH = metrics.rodRadiusY;
 
-    if (rod.getPosition()[1] + rodH/2 < surfacePond)
+    if (rod.getPosition().y + rodH/2 < surfacePond)
     {   // set fish out of view
+        events.push(FishingEventType::LANDED, Vector2D(rod.getPosition().x, surfacePond));
         caughtFishPtr->setPosition(-100,-100);
         // deactivate fish
         caughtFishPtr->setActive(false);
         int points = 1;
-        if(dynamic_cast<MediumFish*>(caughtFishPtr.get()) != nullptr)
+        if(dynamic_cast<MediumFish*>(caughtFishPtr) != nullptr)
         {
             points = 2;
-        } else if(dynamic_cast<BigFish*>(caughtFishPtr.get()) != nullptr)
+        } else if(dynamic_cast<BigFish*>(caughtFishPtr) != nullptr)
         {
             points = 3;
         }
         catchScore += points;
     }  else
     { // continue swimming
+        events.push(FishingEventType::KNOCKED_OFF, rod.getPosition());
         // set fish past rod
         caughtFishPtr->setPosition(rod.getPosition() + rod.getDimens());
-        caughtFishPtr->setSpeed(calculateRandSpeed(caughtFishPtr), 0);
+        caughtFishPtr->setSpeed(calculateRandSpeed(*caughtFishPtr), 0);
         caughtFishPtr->update();
     }
     // rotate fish back to original orientation
-    float oldH = caughtFishPtr->getDimens()[1];
-    float oldW = caughtFishPtr->getDimens()[0];
+    float oldH = caughtFishPtr->getDimens().y;
+    float oldW = caughtFishPtr->getDimens().x;
     // have to split old h and w cuz we're swapping them
     caughtFishPtr->setDimens(oldH, oldW);
 
     // reset caughtFish ptr
-    caughtFishPtr = nullptr;
+    caughtFish = FloaterHandle();
 }
 
 //Method for when a heavy hazard is caught
 void FishingLogic::releaseHeavyHazard()
 {
-    float surfacePond = Scale::scaleH(Visuals::SURFACE_POND_PERCENT);
+    Hazard* caughtHeavyHazardPtr = hookedHeavyHazard();
+    if (!caughtHeavyHazardPtr) {
+        return;
+    }
+
+    float surfacePond = metrics.surfaceY;
 
-    if (rod.getPosition()[1] <= surfacePond)
+    if (rod.getPosition().y <= surfacePond)
     {
+        events.push(FishingEventType::LANDED, Vector2D(rod.getPosition().x, surfacePond));
         caughtHeavyHazardPtr->setActive(false);
         caughtHeavyHazardPtr->setCaught(false);
         caughtHeavyHazardPtr->setPosition(-100, -100);
-        caughtHeavyHazardPtr.reset();
+        caughtHeavyHazard = FloaterHandle();
     }
 }
 
 /** 
- * @brief updater for fishing phase logic, updates logic state each tick
+ * @brief updater for fishing phase logic, updates logic state each tick and publishes a snapshot
  */
 void FishingLogic::update()
+{
+    AllocZone allocZone("FishingLogic::update");
+    step();
+    publishSnapshot();
+}
+
+/**
+ * @brief Copies the current state into the snapshot buffer for views
+ */
+void FishingLogic::publishSnapshot()
+{
+    writeSnapshot(snapshots.beginWrite());
+    snapshots.publish();
+}
+
+/** 
+ * @brief One tick of fishing logic: rod, catches, timer, spawns and floater movement
+ */
+void FishingLogic::step()
 {
     if (!running) {
         return;
     }
 
+    tickCount++;
+
     //Clear stun time if time is up
-    Uint32 now = SDL_GetTicks();
+    Uint32 now = getTicks();
     if (stunned && now >= stunEndTime) stunned = false;
 
+    float hookWasY = rod.getPosition().y;
     rod.updatePos();
+    if (hookWasY < metrics.surfaceY && rod.getPosition().y >= metrics.surfaceY) {
+        events.push(FishingEventType::CAST, Vector2D(rod.getPosition().x, metrics.surfaceY));
+    }
+    Fish* caughtFishPtr = hookedFish();
+    Hazard* caughtHeavyHazardPtr = hookedHeavyHazard();
     if (caughtFishPtr && caughtFishPtr->isCaught()) {
-        caughtFishPtr->setPosition(rod.getPosition()[0], rod.getPosition()[1]);
+        caughtFishPtr->setPosition(rod.getPosition().x, rod.getPosition().y);
         caughtFishPtr->update();
     }
 
@@ -779,8 +826,9 @@ void FishingLogic::update()
     {
         caughtHeavyHazardPtr->setPosition(rod.getPosition());
     }
+    stepLine();
 
-    int currentTime = SDL_GetTicks();
+    int currentTime = getTicks();
 
     // Only check ever 5 frames since expensive
     if (currentTime - lastCheckTime > 80) {
@@ -798,8 +846,7 @@ void FishingLogic::update()
     elapsedTime = currentTime - roundStartTime - totalPauseTime;
     
     // Debug output for timer issues
-    static int lastDebugOutput = 0;
-    if (currentTime - lastDebugOutput > 1000) { // Log once per second
+    if (!headless && currentTime - lastDebugOutput > 1000) { // Log once per second
         std::cout << "FishingLogic: Time remaining: " 
                   << (roundDuration - elapsedTime) / 1000 
                   << " seconds (elapsed: " << elapsedTime / 1000 
@@ -810,8 +857,10 @@ void FishingLogic::update()
     }
     
     if (elapsedTime >= roundDuration) {
-        std::cout << "FishingLogic: Round time expired! elapsed=" 
-                  << elapsedTime << ", duration=" << roundDuration << std::endl;
+        if (!headless) {
+            std::cout << "FishingLogic: Round time expired! elapsed=" 
+                      << elapsedTime << ", duration=" << roundDuration << std::endl;
+        }
         running = false;
         return;
     }
@@ -819,50 +868,78 @@ void FishingLogic::update()
     if (currentTime - lastSpawnTime > spawnInterval) { // Every 3ish seconds
         spawnNewFloaters();
         spawnHazards();
-        lastSpawnTime = SDL_GetTicks();
+        lastSpawnTime = getTicks();
     }
 
-    for(int i = 0; i < allFish.size(); i++)
-    { // update all floater movement w automation
-        if (!(allFish[i]->isCaught()) && allFish[i]->isActive()) allFish[i]->update();
+    school.steer(allFish, floaterThreads);
+    updateFloaters(allFish, fishOffscreen, false); // The hooked fish follows the rod instead
+    updateFloaters(hazards, hazardOffscreen, true);
+}
+
+/**
+ * @brief Steps the fishing line; a hooked fish tugs it the way it faces, a heavy hazard pulls it taut
+ */
+void FishingLogic::stepLine()
+{
+    float load = 0.0f;
+    float sidePull = 0.0f;
+    if (Fish* fish = hookedFish()) {
+        load = Game::LINE_FISH_LOAD;
+        sidePull = fish->getDirection().x > 0 ? 1.0f : -1.0f;
+    }
+    else if (auto heavyHazard = dynamic_cast<HeavyHazard*>(hookedHeavyHazard())) {
+        load = 1.0f - heavyHazard->getSlowFactor(); // Slower reeling, heavier line
+    }
+    line.step(lineTip(), lineHook(), load, sidePull);
+}
 
-        // check if fish is no longer visible
-        if (allFish[i]->isActive()) {
-            // Check direction to determine correct oob
-            if (allFish[i]->getDirection()[0] > 0) {
-                // Fish moving right
-                if (allFish[i]->getPosition()[0] >= Dimens::SCREEN_W) {
-                    allFish[i]->setActive(false);
+/**
+ * @brief Moves a pool's active floaters and retires the ones that swam off screen
+ * @details Chunks of Game::FLOATER_CHUNK floaters run across the job system. A chunk only
+ * touches its own floaters and records the ones leaving in its own mask word; the masks are
+ * applied afterwards in slot order, so the outcome is bit for bit that of a serial pass.
+ * @param pool Floaters to move
+ * @param offscreen One mask word per chunk, sized when the pool was filled
+ * @param moveCaught Whether floaters on the hook still move by their own speed
+ */
+template <typename T>
+void FishingLogic::updateFloaters(FloaterPool<T>& pool, std::vector<uint64_t>& offscreen, bool moveCaught)
+{
+    const int count = static_cast<int>(pool.size());
+    const int chunks = static_cast<int>(offscreen.size());
+    const float screenW = metrics.screenW;
+
+    JobSystem::shared().parallelFor(chunks, Game::PARALLEL_FLOATER_MIN / Game::FLOATER_CHUNK, [&](int firstChunk, int endChunk) {
+        for (int chunk = firstChunk; chunk < endChunk; chunk++) {
+            int begin = chunk * Game::FLOATER_CHUNK;
+            int end = std::min(count, begin + Game::FLOATER_CHUNK);
+            uint64_t leaving = 0;
+            for (int i = begin; i < end; i++) {
+                T& floater = *pool[i];
+                if (!floater.isActive()) {
+                    continue;
                 }
-            } else {
-                // Fish moving left
-                if (allFish[i]->getPosition()[0] + allFish[i]->getDimens()[0] <= 0) {
-                    allFish[i]->setActive(false);
+                if (moveCaught || !floater.isCaught()) {
+                    floater.update();
                 }
-            }
-        }
-    }
 
-    for (int i = 0; i < hazards.size(); i++)
-    { //Updates all hazard movement with automation
-        if (hazards[i]->isActive())
-        {
-            hazards[i]->update();
+                // Check direction to determine correct oob
+                bool gone = floater.getDirection().x > 0
+                    ? floater.getPosition().x >= screenW                        // Moving right
+                    : floater.getPosition().x + floater.getDimens().x <= 0;     // Moving left
+                if (gone) {
+                    leaving |= uint64_t(1) << (i - begin);
+                }
+            }
+            offscreen[chunk] = leaving;
         }
+    }, floaterThreads);
 
-        //Checks to see if hazard is no longer visible
-        if (hazards[i]->isActive()) {
-            // Check direction to determine correct oob
-            if (hazards[i]->getDirection()[0] > 0) {
-                // Hazard moving right
-                if (hazards[i]->getPosition()[0] >= Dimens::SCREEN_W) {
-                    hazards[i]->setActive(false);
-                }
-            } else {
-                // Hazard moving left
-                if (hazards[i]->getPosition()[0] + hazards[i]->getDimens()[0] <= 0) {
-                    hazards[i]->setActive(false);
-                }
+    for (int chunk = 0; chunk < chunks; chunk++) {
+        uint64_t leaving = offscreen[chunk];
+        for (int i = chunk * Game::FLOATER_CHUNK; leaving != 0; i++, leaving >>= 1) {
+            if (leaving & 1) {
+                pool[i]->setActive(false);
             }
         }
     }
@@ -879,16 +956,17 @@ void FishingLogic::setPaused(bool newState) {
     
     if (newState) {
         // Entering pause state
-        pauseStartTime = SDL_GetTicks();
+        pauseStartTime = getTicks();
         paused = true;
     } else {
         // Exiting pause state
         if (pauseStartTime > 0) {
-            totalPauseTime += (SDL_GetTicks() - pauseStartTime);
+            totalPauseTime += (getTicks() - pauseStartTime);
             pauseStartTime = 0;
         }
         paused = false;
     }
+    publishSnapshot();
 }
 
 void FishingLogic::pauseGame() {
@@ -917,11 +995,29 @@ void FishingLogic::quitToMenu() {
  *          not when the FishingLogic object is created >:(
  */
 void FishingLogic::resetRoundStartTime() {
-    roundStartTime = SDL_GetTicks();
+    roundStartTime = getTicks();
     lastSpawnTime = roundStartTime;
     elapsedTime = 0;
     totalPauseTime = 0;
     pauseStartTime = 0;
     
-    std::cout << "FishingLogic: Round start time reset to " << roundStartTime << std::endl;
+    if (!headless) std::cout << "FishingLogic: Round start time reset to " << roundStartTime << std::endl;
+}
+
+/**
+ * @brief Current round clock in ms
+ * @return SDL ticks, or the simulated clock when headless
+ */
+Uint32 FishingLogic::getTicks() const
+{
+    return headless ? simulatedTicks : SDL_GetTicks();
+}
+
+/**
+ * @brief Advances the simulated clock for headless rounds
+ * @param ms Milliseconds to advance, normally one frame per update()
+ */
+void FishingLogic::advanceClock(Uint32 ms)
+{
+    simulatedTicks += ms;
 }
\ No newline at end of file
@@ -1,10 +1,12 @@
 // Update the FishingView constructor to initialize the pause menu
 
 #include <SDL.h>
-#include <SDL2_gfxPrimitives.h>
 #include <SDL_ttf.h>
 #include <sstream>
 #include <iomanip>
+#include <cstdio> // For formatting timer and score text
+#include <algorithm> // For effect catch-up limits
+#include <cmath> // For the water strip and scaled scene sizes
 #include <iostream> // For debug messages
 
 #include "fishing_view.hpp" // Class headerfile
@@ -19,6 +21,38 @@
 #include "game_constants.hpp" // For visuals scaling constants and sprite filepaths
 #include "scaling.hpp" // For scaling helpers
 #include "pause_menu.hpp" // For pause menu
+#include "render_thread.hpp" // Fonts are opened and closed beside text rasterization
+#include "alloc_tracker.hpp" // For steady-state allocation checks
+
+namespace
+{
+    const float UP = -1.5707964f; // Screen y grows downwards
+    const float ALL_AROUND = 3.1415927f;
+
+    // Effect bursts, world units
+    const ParticleEmitter SPLASH = {120, 2.0f, 6.0f, UP, 0.9f, 25.0f, 45.0f, 2.0f, 5.0f, 0.25f, 0.98f, {200, 230, 255, 230}};
+    const ParticleEmitter BUBBLES = {40, 0.3f, 1.2f, UP, 1.2f, 40.0f, 80.0f, 2.0f, 6.0f, -0.03f, 0.95f, {220, 240, 255, 160}};
+    const ParticleEmitter SPARKS = {200, 2.0f, 8.0f, 0.0f, ALL_AROUND, 10.0f, 25.0f, 1.5f, 3.0f, 0.0f, 0.9f, {255, 240, 120, 255}};
+    const ParticleEmitter DEBRIS = {60, 1.0f, 4.0f, 0.0f, ALL_AROUND, 15.0f, 30.0f, 2.0f, 4.0f, 0.05f, 0.92f,
+                                    {Colors::Orange::R, Colors::Orange::G, Colors::Orange::B, Colors::Orange::A}};
+
+    /**
+     * @brief Burst shown for an event
+     */
+    const ParticleEmitter& emitterFor(FishingEventType type)
+    {
+        switch (type) {
+            case FishingEventType::LANDED:
+                return SPLASH;
+            case FishingEventType::STUNNED:
+                return SPARKS;
+            case FishingEventType::HAZARD_HIT:
+                return DEBRIS;
+            default:
+                return BUBBLES;
+        }
+    }
+}
 
 /**
  * @brief basic error thrower
@@ -32,24 +66,39 @@ void throwError(const std::string &msg)
 
 /**
  * @brief View constructor, attempts to load font, sprites, TextureManager
+ * @param screen Scaled sizes for the window, used by the UI overlay
  */
-FishingView::FishingView(const std::shared_ptr<FishingLogic> &logicPtr, SDL_Window* window, SDL_Renderer* renderer, float screenH, float screenW)
+FishingView::FishingView(const std::shared_ptr<FishingLogic> &logicPtr, SDL_Window* window, SDL_Renderer* renderer, const WorldMetrics& screen)
     : logicPtr(logicPtr), 
       window(window), 
       renderer(renderer), 
-      screenH(screenH), 
-      screenW(screenW), 
+      world(logicPtr->getMetrics()), 
+      screen(screen), 
+      scaledFontSize(Scale::scaleFontSize(Visuals::FONT_SIZE)), 
       textureManager(renderer), 
       showHitboxes(false),
-      pauseMenu(renderer, nullptr, nullptr, Dimens::SCREEN_W, Dimens::SCREEN_H)
+      pauseMenu(renderer, nullptr, nullptr, screen.screenW, screen.screenH),
+      particles(Visuals::PARTICLE_CAPACITY),
+      water(static_cast<int>(std::ceil(screen.screenW / Visuals::WATER_COLUMN_PIXELS)), Visuals::WATER_TEXTURE_ROWS,
+            logicPtr->getMetrics()),
+      hookY(logicPtr->getRod().getPosition().y)
       {
 
     // init TTF - should be redundant but game crashes without it
     if(TTF_Init() < 0) throwError("Unable to initialize TTF!");
-    int scaledFontSize = Scale::scaleFontSize(Visuals::FONT_SIZE);
-    font = TTF_OpenFont(Resource::WATERLILY.c_str(), scaledFontSize);
     int scaledHoverFontSize = Scale::scaleFontSize(Visuals::HOVER_FONT_SIZE);
-    hoverFont = TTF_OpenFont(Resource::ARIAL.c_str(), scaledHoverFontSize);
+    RenderThread::runOnRenderer([&] {
+        font = TTF_OpenFont(Resource::WATERLILY.c_str(), scaledFontSize);
+        hoverFont = TTF_OpenFont(Resource::ARIAL.c_str(), scaledHoverFontSize);
+        waterTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                         water.getColumns(), water.getRows());
+        if (waterTexture) {
+            SDL_SetTextureBlendMode(waterTexture, SDL_BLENDMODE_BLEND);
+        }
+    });
+    if (!waterTexture) {
+        std::cerr << "Failed to create water surface texture: " << SDL_GetError() << std::endl;
+    }
     
     // Update pause menu with loaded fonts instead of reinitializing
     pauseMenu.setFonts(font, hoverFont);
@@ -72,6 +121,8 @@ FishingView::FishingView(const std::shared_ptr<FishingLogic> &logicPtr, SDL_Wind
     if (!textureManager.loadTexture(Resource::BG_FISHING_ANIM2_ID, Resource::BG_FISHING_ANIM2)) {
         std::cerr << "Failed to load fishing background animation frame 2" << std::endl;
     }
+    backgroundAnimation = textureManager.addAnimation(Resource::BG_FISHING_ANIM1_ID, Resource::BG_FISHING_ANIM2_ID,
+        Game::BACKGROUND_ANIMATION_DELAY);
 }
 
 /**
@@ -79,214 +130,278 @@ FishingView::FishingView(const std::shared_ptr<FishingLogic> &logicPtr, SDL_Wind
  */
 FishingView::~FishingView()
 {
-    TTF_CloseFont(font);
-    TTF_CloseFont(hoverFont);
+    RenderThread::runOnRenderer([this] {
+        TTF_CloseFont(font);
+        TTF_CloseFont(hoverFont);
+        if (waterTexture) {
+            SDL_DestroyTexture(waterTexture);
+        }
+    });
     // quit text SDL
 }
 
+namespace
+{
+    /**
+     * @struct FloaterSpriteNames
+     * @brief Texture names for one floater kind
+     */
+    struct FloaterSpriteNames
+    {
+        const std::string& base;
+        const std::string& anim1;
+        const std::string& anim2;
+    };
+
+    /**
+     * @brief Texture names for a floater kind, matching each class's sprite getters; load time only
+     * @param kind Floater kind
+     * @return FloaterSpriteNames base and animation frame names
+     */
+    FloaterSpriteNames spriteNamesFor(FloaterKind kind)
+    {
+        switch (kind) {
+            case FloaterKind::MEDIUM_FISH:
+                return {Resource::FISH_MEDIUM_ID, Resource::FISH_MEDIUM_ANIM1_ID, Resource::FISH_MEDIUM_ANIM2_ID};
+            case FloaterKind::BIG_FISH:
+                return {Resource::FISH_BIG_ID, Resource::FISH_BIG_ANIM1_ID, Resource::FISH_BIG_ANIM2_ID};
+            case FloaterKind::HAZARD:
+                return {Resource::HAZARD_BARRACUDA_ID, Resource::HAZARD_BARRACUDA_ANIM1_ID, Resource::HAZARD_BARRACUDA_ANIM2_ID};
+            case FloaterKind::HEAVY_HAZARD:
+                return {Resource::HAZARD_HEAVY_ID, Resource::HAZARD_BARRACUDA_ANIM1_ID, Resource::HAZARD_BARRACUDA_ANIM2_ID};
+            case FloaterKind::SHOCK_HAZARD:
+                return {Resource::HAZARD_SHOCK_ID, Resource::HAZARD_BARRACUDA_ANIM1_ID, Resource::HAZARD_BARRACUDA_ANIM2_ID};
+            case FloaterKind::SMALL_FISH:
+            default:
+                return {Resource::FISH_SMALL_ID, Resource::FISH_SMALL_ANIM1_ID, Resource::FISH_SMALL_ANIM2_ID};
+        }
+    }
+}
+
 /**
  * @brief Loads sprites into texture manager
  * @return bool true if successful, false if not
  */
 bool FishingView::loadSprites() {
-    bool success = true;
-
-    // Load regular fish sprites (for caught fish)
-    success &= textureManager.loadTexture(Resource::FISH_SMALL_ID, Resource::FISH_SMALL);
-    success &= textureManager.loadTexture(Resource::FISH_MEDIUM_ID, Resource::FISH_MEDIUM);
-    success &= textureManager.loadTexture(Resource::FISH_BIG_ID, Resource::FISH_BIG);
-    
-    // Load animated fish sprites
-    success &= textureManager.loadTexture(Resource::FISH_SMALL_ANIM1_ID, Resource::FISH_SMALL_ANIM1);
-    success &= textureManager.loadTexture(Resource::FISH_SMALL_ANIM2_ID, Resource::FISH_SMALL_ANIM2);
-    success &= textureManager.loadTexture(Resource::FISH_MEDIUM_ANIM1_ID, Resource::FISH_MEDIUM_ANIM1);
-    success &= textureManager.loadTexture(Resource::FISH_MEDIUM_ANIM2_ID, Resource::FISH_MEDIUM_ANIM2);
-    success &= textureManager.loadTexture(Resource::FISH_BIG_ANIM1_ID, Resource::FISH_BIG_ANIM1);
-    success &= textureManager.loadTexture(Resource::FISH_BIG_ANIM2_ID, Resource::FISH_BIG_ANIM2);
-    
-    // Load hazard sprites
-    success &= textureManager.loadTexture(Resource::HAZARD_HEAVY_ID, Resource::HAZARD_HEAVY);
-    success &= textureManager.loadTexture(Resource::HAZARD_SHOCK_ID, Resource::HAZARD_SHOCK);
-    success &= textureManager.loadTexture(Resource::HAZARD_BARRACUDA_ID, Resource::HAZARD_BARRACUDA);
-    success &= textureManager.loadTexture(Resource::HAZARD_BARRACUDA_ANIM1_ID, Resource::HAZARD_BARRACUDA_ANIM1);
-    success &= textureManager.loadTexture(Resource::HAZARD_BARRACUDA_ANIM2_ID, Resource::HAZARD_BARRACUDA_ANIM2);
+    // Decoded together so the pool can work through the images in parallel
+    bool success = textureManager.loadTextures({
+        // Regular fish sprites (for caught fish)
+        {Resource::FISH_SMALL_ID, Resource::FISH_SMALL},
+        {Resource::FISH_MEDIUM_ID, Resource::FISH_MEDIUM},
+        {Resource::FISH_BIG_ID, Resource::FISH_BIG},
+
+        // Animated fish sprites
+        {Resource::FISH_SMALL_ANIM1_ID, Resource::FISH_SMALL_ANIM1},
+        {Resource::FISH_SMALL_ANIM2_ID, Resource::FISH_SMALL_ANIM2},
+        {Resource::FISH_MEDIUM_ANIM1_ID, Resource::FISH_MEDIUM_ANIM1},
+        {Resource::FISH_MEDIUM_ANIM2_ID, Resource::FISH_MEDIUM_ANIM2},
+        {Resource::FISH_BIG_ANIM1_ID, Resource::FISH_BIG_ANIM1},
+        {Resource::FISH_BIG_ANIM2_ID, Resource::FISH_BIG_ANIM2},
+
+        // Hazard sprites
+        {Resource::HAZARD_HEAVY_ID, Resource::HAZARD_HEAVY},
+        {Resource::HAZARD_SHOCK_ID, Resource::HAZARD_SHOCK},
+        {Resource::HAZARD_BARRACUDA_ID, Resource::HAZARD_BARRACUDA},
+        {Resource::HAZARD_BARRACUDA_ANIM1_ID, Resource::HAZARD_BARRACUDA_ANIM1},
+        {Resource::HAZARD_BARRACUDA_ANIM2_ID, Resource::HAZARD_BARRACUDA_ANIM2}
+    });
+
+    // Resolve names to ids once; a kind's floaters share one animation so they swim in step
+    for (int kind = 0; kind < FLOATER_KINDS; kind++) {
+        FloaterSpriteNames names = spriteNamesFor(static_cast<FloaterKind>(kind));
+        floaterSprites[kind].still = textureManager.getSpriteId(names.base);
+        floaterSprites[kind].swim = textureManager.addAnimation(names.anim1, names.anim2, Game::FISH_ANIMATION_DELAY);
+    }
 
     return success;
 }
 
 /**
- * @brief Draws each fish in fish vector
+ * @brief Draws each fish in a snapshot
+ * @param snapshot Round state to draw
  */
-void FishingView::drawFish()
+void FishingView::drawFish(RenderCommandBuffer& commands, const FishingSnapshot& snapshot)
 {
-    // get ref since expensive
-    std::vector<std::shared_ptr<Fish>>& allFish = logicPtr->getAllFishRef();
-    for(int i = 0; i < allFish.size(); i++)
+    for (const FloaterSnapshot& fish : snapshot.fish)
     {
-        if (!allFish[i]->isActive()) continue;
-        
-        int x = allFish[i]->getPosition()[0];
-        int y = allFish[i]->getPosition()[1];
-        int w = allFish[i]->getDimens()[0];
-        int h = allFish[i]->getDimens()[1];
+        int x = fish.position.x;
+        int y = fish.position.y;
+        int w = fish.dimens.x;
+        int h = fish.dimens.y;
 
         // Get correct sprite direction
-        SDL_RendererFlip flip = (allFish[i]->getDirection()[0] > 0) ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
-
-        // Get the appropriate sprite IDs from the fish itself
-        std::string baseId = allFish[i]->getSpriteID();
-        std::string anim1Id = allFish[i]->getAnimFrame1ID();
-        std::string anim2Id = allFish[i]->getAnimFrame2ID();
+        SDL_RendererFlip flip = fish.facingRight ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
+        const FloaterSprites& sprites = floaterSprites[static_cast<int>(fish.kind)];
         
         // Draw sprite
-        if (allFish[i]->isCaught()) {
+        if (fish.caught) {
             // Caught fish uses static texture
             // Swap dimensions back
             int oldW = h;
             int oldH = w;
 
-            Rod rod = logicPtr->getRod();
-            int rodX = rod.getPosition()[0];
-            int rodY = rod.getPosition()[1];
+            int rodX = snapshot.rodPosition.x;
+            int rodY = snapshot.rodPosition.y;
 
             // Make fish hang from mouth
             int adjX = rodX - oldW / 2;
             int adjY = rodY + oldH;
 
             // Rotate based on direction
-            double angle = (allFish[i]->getDirection()[0] > 0) ? -90.0 : 90.0;
+            double angle = fish.facingRight ? -90.0 : 90.0;
 
-            textureManager.drawRotatedTexture(baseId, adjX, adjY, oldW, oldH, angle, flip);
+            textureManager.drawRotatedTexture(commands, sprites.still, adjX, adjY, oldW, oldH, angle, flip);
         } else {
             // Swimming fish uses animated texture
-            textureManager.drawAnimatedTexture(baseId, anim1Id, anim2Id, x, y, w, h, Game::FISH_ANIMATION_DELAY, flip);
+            textureManager.drawAnimatedTexture(commands, sprites.swim, x, y, w, h, flip);
         }
     }
 }
 
 /**
- * @brief Draws each hazard in hazard vector
+ * @brief Draws each hazard in a snapshot
+ * @param snapshot Round state to draw
  */
-void FishingView::drawHazard()
+void FishingView::drawHazard(RenderCommandBuffer& commands, const FishingSnapshot& snapshot)
 {
-    std::vector<std::shared_ptr<Hazard>>& hazards = logicPtr->getHazardsRef();
-    for (int i = 0; i < hazards.size(); i++)
+    for (const FloaterSnapshot& hazard : snapshot.hazards)
     {
-        if (!hazards[i]->isActive()) continue;
-        
-        int x = hazards[i]->getPosition()[0];
-        int y = hazards[i]->getPosition()[1];
-        int w = hazards[i]->getDimens()[0];
-        int h = hazards[i]->getDimens()[1];
+        int x = hazard.position.x;
+        int y = hazard.position.y;
+        int w = hazard.dimens.x;
+        int h = hazard.dimens.y;
 
         // Get correct sprite direction
-        SDL_RendererFlip flip = (hazards[i]->getDirection()[0] > 0) ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
+        SDL_RendererFlip flip = hazard.facingRight ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
+        const FloaterSprites& sprites = floaterSprites[static_cast<int>(hazard.kind)];
 
-        if (auto heavyHazard = dynamic_cast<HeavyHazard*>(hazards[i].get()))
+        if (hazard.kind == FloaterKind::HEAVY_HAZARD)
         {
-            if (hazards[i]->isCaught()) {
+            if (hazard.caught) {
                 // Rotate and offset to make it hang
-                Rod rod = logicPtr->getRod();
-                int rodX = rod.getPosition()[0];
-                int rodY = rod.getPosition()[1];
+                int rodX = snapshot.rodPosition.x;
+                int rodY = snapshot.rodPosition.y;
                 int offsetX = w / 4;
                 int adjX = rodX - w / 2 + offsetX;
                 int adjY = rodY + h / 3;
                 double angle = -90.0;
-                textureManager.drawRotatedTexture(Resource::HAZARD_HEAVY_ID, adjX, adjY, w, h, angle, SDL_FLIP_NONE);
+                textureManager.drawRotatedTexture(commands, sprites.still, adjX, adjY, w, h, angle, SDL_FLIP_NONE);
             } else {
                 // Cannon sprite for heavy hazard (not caught)
-                textureManager.drawTexture(Resource::HAZARD_HEAVY_ID, x, y, w, h, flip);
+                textureManager.drawTexture(commands, sprites.still, x, y, w, h, flip);
             }
         }
-        else if (dynamic_cast<ShockHazard*>(hazards[i].get()))
+        else if (hazard.kind == FloaterKind::SHOCK_HAZARD)
         {
             // Skeleton sprite for shock hazard
-            textureManager.drawTexture(Resource::HAZARD_SHOCK_ID, x, y, w, h, flip);
+            textureManager.drawTexture(commands, sprites.still, x, y, w, h, flip);
         }
         else
         {
             // Animated barracuda for normal hazard
-            std::string baseId = hazards[i]->getSpriteID();
-            std::string anim1Id = hazards[i]->getAnimFrame1ID();
-            std::string anim2Id = hazards[i]->getAnimFrame2ID();
-            
-            textureManager.drawAnimatedTexture(baseId, anim1Id, anim2Id, x, y, w, h, Game::FISH_ANIMATION_DELAY, flip);
+            textureManager.drawAnimatedTexture(commands, sprites.swim, x, y, w, h, flip);
         }
     }
 }
 
 /**
  * @brief draws fishing rod
+ * @param snapshot Round state to draw
  */
-void FishingView::drawFishingRod()
+void FishingView::drawFishingRod(RenderCommandBuffer& commands, const FishingSnapshot& snapshot)
 {
-    Rod rod = logicPtr->getRod();
-    int x = rod.getPosition()[0];
-    int y = rod.getPosition()[1];
+    int x = snapshot.rodPosition.x;
+    int y = snapshot.rodPosition.y;
 
-    // Scale
-    int rx = Scale::scaleY(Game::ROD_RADIUSX_PERCENT);
-    int ry = Scale::scaleH(Game::ROD_RADIUSY_PERCENT);
-    float rodTopY = Scale::scaleH(0.04f);
+    // Precomputed hook size, same radii the hitbox is derived from
+    int rx = world.rodRadiusX;
+    int ry = world.rodRadiusY;
 
-    thickLineRGBA(renderer, x, rodTopY, x, y - ry,2,Colors::White::R, Colors::White::G, Colors::White::B, Colors::White::A);
-    ellipseRGBA(renderer, x, y, rx, ry, Colors::Black::R, Colors::Black::G, Colors::Black::B, Colors::Black::A);
+    commands.lineStrip(snapshot.linePoints, Game::LINE_SEGMENTS + 1, 2.0f,
+                       {Colors::White::R, Colors::White::G, Colors::White::B, Colors::White::A});
+    commands.ellipse(x, y, rx, ry, {Colors::Black::R, Colors::Black::G, Colors::Black::B, Colors::Black::A});
 }
 
 /**
  * @brief draws hitboxes for collision debugging
+ * @param snapshot Round state to draw
  */
-void FishingView::drawHitboxes() {
+void FishingView::drawHitboxes(RenderCommandBuffer& commands, const FishingSnapshot& snapshot) {
     if (!showHitboxes) return;
 
     // Rod hitbox
-    Rod rod = logicPtr->getRod();
-    int rodX = rod.getPosition()[0];
-    int rodY = rod.getPosition()[1];
-    int rodRX = Scale::scaleW(Game::ROD_RADIUSX_PERCENT) * 1.2f;
-    int rodRY = Scale::scaleH(Game::ROD_RADIUSY_PERCENT) * 1.2f;
-    ellipseRGBA(renderer, rodX, rodY, rodRX, rodRY, Colors::DarkBlue::R, Colors::DarkBlue::G, Colors::DarkBlue::B, 128);
+    int rodX = snapshot.rodPosition.x;
+    int rodY = snapshot.rodPosition.y;
+    int rodRX = world.rodHitRadiusX;
+    int rodRY = world.rodHitRadiusY;
+    commands.ellipse(rodX, rodY, rodRX, rodRY, {Colors::DarkBlue::R, Colors::DarkBlue::G, Colors::DarkBlue::B, 128});
 
     // Fish hitboxes
-    std::vector<std::shared_ptr<Fish>>& allFish = logicPtr->getAllFishRef();
-    for (int i = 0; i < allFish.size(); i++) {
-        if (allFish[i]->isActive()) {
-            int x = allFish[i]->getPosition()[0];
-            int y = allFish[i]->getPosition()[1];
-            int w = allFish[i]->getDimens()[0];
-            int h = allFish[i]->getDimens()[1];
-
-            int hitboxSize = h / 2;
-            int hitboxX, hitboxY;
-
-            if (allFish[i]->getDirection()[0] > 0) {
-                hitboxX = x + w - hitboxSize - 5;
-            } else {
-                hitboxX = x + 5;
-            }
+    for (const FloaterSnapshot& fish : snapshot.fish) {
+        int x = fish.position.x;
+        int y = fish.position.y;
+        int w = fish.dimens.x;
+        int h = fish.dimens.y;
 
-            hitboxY = y + (h - hitboxSize) / 2;
+        int hitboxSize = h / 2;
+        int hitboxX, hitboxY;
 
-            // Bounding box
-            boxRGBA(renderer, x, y, x + w, y + h, Colors::DarkGreen::R, Colors::DarkGreen::G, Colors::DarkGreen::B, 128);
-            // Hitbox
-            boxRGBA(renderer, hitboxX, hitboxY, hitboxX + hitboxSize, hitboxY + hitboxSize, Colors::DarkGreen::R, Colors::DarkGreen::G, Colors::DarkGreen::B, 200);
+        if (fish.facingRight) {
+            hitboxX = x + w - hitboxSize - 5;
+        } else {
+            hitboxX = x + 5;
         }
+
+        hitboxY = y + (h - hitboxSize) / 2;
+
+        // Bounding box
+        commands.fillRect({x, y, w, h}, {Colors::DarkGreen::R, Colors::DarkGreen::G, Colors::DarkGreen::B, 128});
+        // Hitbox
+        commands.fillRect({hitboxX, hitboxY, hitboxSize, hitboxSize}, {Colors::DarkGreen::R, Colors::DarkGreen::G, Colors::DarkGreen::B, 200});
     }
 
     // Hazard hitboxes
-    std::vector<std::shared_ptr<Hazard>>& hazards = logicPtr->getHazardsRef();
-    for (int i = 0; i < hazards.size(); i++) {
-        if (hazards[i]->isActive()) {
-            int x = hazards[i]->getPosition()[0];
-            int y = hazards[i]->getPosition()[1];
-            int w = hazards[i]->getDimens()[0];
-            int h = hazards[i]->getDimens()[1];
-
-            boxRGBA(renderer, x, y, x + w, y + h, Colors::Red::R, Colors::Red::G, Colors::Red::B, 128);
-        }
+    for (const FloaterSnapshot& hazard : snapshot.hazards) {
+        int x = hazard.position.x;
+        int y = hazard.position.y;
+        int w = hazard.dimens.x;
+        int h = hazard.dimens.y;
+
+        commands.fillRect({x, y, w, h}, {Colors::Red::R, Colors::Red::G, Colors::Red::B, 128});
+    }
+}
+
+/**
+ * @brief Draws a round's world (background, rod, floaters) in world coordinates
+ * @param snapshot Round state to draw
+ */
+void FishingView::drawWorld(RenderCommandBuffer& commands, const FishingSnapshot& snapshot, bool effects)
+{
+    drawBackground(commands);
+    if (effects) {
+        drawWater(commands);
+    }
+    drawFishingRod(commands, snapshot);
+    drawFish(commands, snapshot);
+    drawHazard(commands, snapshot);
+    if (effects) {
+        particles.draw(commands);
     }
+    drawHitboxes(commands, snapshot);
+}
+
+/**
+ * @brief Uploads the ripple strip and draws it over the background's waterline
+ */
+void FishingView::drawWater(RenderCommandBuffer& commands)
+{
+    if (!waterTexture) {
+        return;
+    }
+    water.rasterize();
+    commands.updateTexture(waterTexture, water.getPixels(), water.getColumns(), water.getRows());
+    SDL_Rect strip = {0, static_cast<int>(water.getTop()), static_cast<int>(world.screenW), static_cast<int>(std::ceil(water.getHeight()))};
+    commands.sprite(waterTexture, strip);
 }
 
 /**
@@ -298,62 +413,30 @@ void FishingView::toggleHitboxes() {
 
 /**
  * @brief Helper method to draw a styled text box like the one in store_view
+ * @param commands Frame being recorded
  * @param x X position of the box
  * @param y Y position of the box
  * @param width Width of the box
  * @param height Height of the box
  * @param text Text to display in the box
  */
-void FishingView::drawStyledBox(int x, int y, int width, int height, const std::string& text) {
+void FishingView::drawStyledBox(RenderCommandBuffer& commands, int x, int y, int width, int height, const char* text) {
     // Box dimensions
     SDL_Rect boxRect = {x, y, width, height};
     
     // Draw background - tan color
-    SDL_SetRenderDrawColor(renderer, Colors::Tan::R, Colors::Tan::G, Colors::Tan::B, Colors::Tan::A);
-    SDL_RenderFillRect(renderer, &boxRect);
+    commands.fillRect(boxRect, {Colors::Tan::R, Colors::Tan::G, Colors::Tan::B, Colors::Tan::A});
     
     // Draw outer border - darker brown
-    SDL_SetRenderDrawColor(renderer, Colors::Brown::R, Colors::Brown::G, Colors::Brown::B, Colors::Brown::A);
-    SDL_RenderDrawRect(renderer, &boxRect);
+    commands.outlineRect(boxRect, {Colors::Brown::R, Colors::Brown::G, Colors::Brown::B, Colors::Brown::A});
     
     // Draw inner border - lighter highlight
     SDL_Rect innerRect = {x + 2, y + 2, width - 4, height - 4};
-    SDL_SetRenderDrawColor(renderer, Colors::Wheat::R, Colors::Wheat::G, Colors::Wheat::B, Colors::Wheat::A);
-    SDL_RenderDrawRect(renderer, &innerRect);
-    
-    // Render text
-    int scaledFontSize = Scale::scaleFontSize(Visuals::FONT_SIZE);
-    TTF_SetFontSize(font, scaledFontSize);
+    commands.outlineRect(innerRect, {Colors::Wheat::R, Colors::Wheat::G, Colors::Wheat::B, Colors::Wheat::A});
     
-    // Darker brown text color
+    // Darker brown text, centered in box
     SDL_Color textColor = {Colors::DarkBrown::R, Colors::DarkBrown::G, Colors::DarkBrown::B, Colors::DarkBrown::A};
-    
-    SDL_Surface* textSurface = TTF_RenderText_Blended(font, text.c_str(), textColor);
-    if (!textSurface) {
-        std::cerr << "Failed to create text surface: " << TTF_GetError() << std::endl;
-        return;
-    }
-    
-    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-    if (!textTexture) {
-        SDL_FreeSurface(textSurface);
-        std::cerr << "Failed to create texture from text surface: " << SDL_GetError() << std::endl;
-        return;
-    }
-    
-    // Center text in box
-    SDL_Rect textRect = {
-        x + (width - textSurface->w) / 2,
-        y + (height - textSurface->h) / 2,
-        textSurface->w,
-        textSurface->h
-    };
-    
-    SDL_RenderCopy(renderer, textTexture, NULL, &textRect);
-    
-    // Clean up
-    SDL_FreeSurface(textSurface);
-    SDL_DestroyTexture(textTexture);
+    commands.text(font, scaledFontSize, text, boxRect, textColor, TextAlign::CENTER);
 }
 
 
@@ -361,46 +444,121 @@ void FishingView::drawStyledBox(int x, int y, int width, int height, const std::
 /**
  * @brief draws background sprite with animation
  */
-void FishingView::drawBackground()
+void FishingView::drawBackground(RenderCommandBuffer& commands)
 {
     // Render animated background instead of static one
-    textureManager.drawAnimatedTexture(
-        Resource::BG_FISHING_ID, 
-        Resource::BG_FISHING_ANIM1_ID, 
-        Resource::BG_FISHING_ANIM2_ID, 
-        0, 0, Dimens::SCREEN_W, Dimens::SCREEN_H,
-        Game::BACKGROUND_ANIMATION_DELAY
-    );
+    textureManager.drawAnimatedTexture(commands, backgroundAnimation, 0, 0, world.screenW, world.screenH);
 
-    float surfacePond = Scale::scaleH(Visuals::SURFACE_POND_PERCENT);
+    float surfacePond = world.surfaceY;
 
     /*
     // DEBUG: draw waterline
-    int lineThicc = std::max(2, (int)(4 * Scale::getHeightScaleFactor()));
-    boxRGBA(renderer, screenW, surfacePond, 0, surfacePond + lineThicc,
+    int lineThicc = std::max(2, (int)(4 * world.heightScale));
+    boxRGBA(renderer, world.screenW, surfacePond, 0, surfacePond + lineThicc,
         Colors::Gray::R, Colors::Gray::G, Colors::Gray::B, Colors::Gray::A);
     */
 }
 
 /**
- * @brief view updater, calls each of the draw methods
+ * @brief Starts effects for the snapshot's new events and hook movement, then steps them once per logic tick since the last frame
+ * @param snapshot Round state being drawn
  */
-void FishingView::drawView()
+void FishingView::updateEffects(const FishingSnapshot& snapshot)
 {
-    SDL_RenderClear(renderer);
-    drawBackground();
-    // display view to user
-    drawFishingRod();
-    drawFish();
-    drawHazard();
-    drawTimer(); // Draw timer first
-    drawScore(); // Then draw score directly beneath it
-    drawHitboxes();
-    
-    // If the game is paused, render the pause menu
-    if (logicPtr->isPaused()) {
-        pauseMenu.render();
+    const FishingEventQueue& events = snapshot.events;
+    for (uint32_t number = std::max(handledEvents, events.getOldest()); number < events.getCount(); number++) {
+        const FishingEvent& event = events.get(number);
+        particles.emit(emitterFor(event.type), event.position, world.heightScale);
+        if (event.type == FishingEventType::LANDED) {
+            water.disturb(event.position.x, Visuals::WATER_LANDED_SPLASH * world.heightScale);
+        }
+    }
+    handledEvents = events.getCount();
+
+    // The hook dents the water the way it crosses it, harder the faster it goes
+    float newHookY = snapshot.rodPosition.y;
+    if ((hookY < world.surfaceY) != (newHookY < world.surfaceY)) {
+        water.disturb(snapshot.rodPosition.x, Visuals::WATER_HOOK_SPLASH * (newHookY - hookY));
+    }
+    hookY = newHookY;
+
+    // Paused rounds don't tick, so their effects hold still too
+    uint32_t ticks = std::min<uint32_t>(snapshot.tick - effectTick, Visuals::MAX_PARTICLE_STEPS);
+    effectTick = snapshot.tick;
+    for (uint32_t i = 0; i < ticks; i++) {
+        particles.step();
+        water.step();
+    }
+}
+
+/**
+ * @brief view updater, records each of the draw methods
+ * @param commands Frame being recorded
+ * @param sceneTarget Window-sized render target to draw the world into at sceneScale and upscale from,
+ * nullptr to draw the world straight into the window
+ * @param sceneScale Share of the window's resolution the world is drawn at in sceneTarget
+ */
+void FishingView::drawView(RenderCommandBuffer& commands, SDL_Texture* sceneTarget, float sceneScale)
+{
+    AllocZone allocZone("FishingView::drawView");
+    commands.clear({0, 0, 0, 255});
+
+    // Only the latest published snapshot is read, never the live logic state
+    const FishingSnapshot& snapshot = logicPtr->acquireSnapshot();
+
+    // World pass: logic coordinates are in world space, one transform maps them to the window
+    // (or to the scaled corner of the scene target)
+    float scale = sceneTarget ? sceneScale : 1.0f;
+    if (sceneTarget) {
+        commands.setTarget(sceneTarget);
+        commands.clear({0, 0, 0, 255});
+    }
+    commands.setTransform(scale * screen.screenW / world.screenW, scale * screen.screenH / world.screenH);
+    updateEffects(snapshot);
+    drawWorld(commands, snapshot, true);
+    if (sceneTarget) {
+        commands.setTarget(nullptr);
+        commands.resetTransform();
+        SDL_Rect window = {0, 0, static_cast<int>(screen.screenW), static_cast<int>(screen.screenH)};
+        SDL_Rect scaled = {0, 0, static_cast<int>(std::lround(window.w * scale)), static_cast<int>(std::lround(window.h * scale))};
+        commands.spriteRegion(sceneTarget, scaled, window);
     }
+
+    // UI pass in window pixels
+    commands.resetTransform();
+    drawTimer(commands, snapshot); // Draw timer first
+    drawScore(commands, snapshot); // Then draw score directly beneath it
+}
+
+/**
+ * @brief Draws the pause menu over the round; kept out of drawView so a paused scene can be frozen under it
+ * @param commands Frame being recorded
+ */
+void FishingView::drawPauseMenu(RenderCommandBuffer& commands)
+{
+    pauseMenu.render(commands);
+}
+
+/**
+ * @brief Draws another round's snapshot into part of the window (split-screen/tournament lanes)
+ * @param commands Frame being recorded
+ * @param snapshot Round state to draw, e.g. from LaneScheduler::getSnapshot
+ * @param viewport Window area in pixels; the world is scaled to fill it
+ */
+void FishingView::drawLane(RenderCommandBuffer& commands, const FishingSnapshot& snapshot, const SDL_Rect& viewport)
+{
+    // Floaters swim in from off screen, so clip them to the lane
+    commands.setClip(&viewport);
+    commands.setTransform(viewport.w / world.screenW, viewport.h / world.screenH, viewport.x, viewport.y);
+    drawWorld(commands, snapshot);
+
+    commands.resetTransform();
+    commands.setClip(nullptr);
+
+    // Lane score in the corner of its viewport
+    char scoreText[16];
+    std::snprintf(scoreText, sizeof(scoreText), "%d", snapshot.catchScore);
+    drawStyledBox(commands, viewport.x + 4, viewport.y + 4, screen.scaleW(0.1f), screen.scaleH(0.04f), scoreText);
 }
 
 /**
@@ -446,7 +604,7 @@ UserInput::Action FishingView::handleKeyboardInput(SDL_Event &e)
                 break;
         }
     }
-    return handleContinuousInput();
+    return UserInput::Action::NONE; // Held direction keys are read by ProcessManager's InputQueue
 }
 
 
@@ -462,38 +620,19 @@ void FishingView::handlePauseMenuInput(SDL_Event &e)
     }
 }
 
-/**
- * @brief handles continues input for smooth movement
- * @return action event based on keyboard state
- */
-UserInput::Action FishingView::handleContinuousInput() {
-    const Uint8* keyState = SDL_GetKeyboardState(nullptr);
-
-    if (keyState[SDL_SCANCODE_LEFT] && keyState[SDL_SCANCODE_RIGHT] ||
-        keyState[SDL_SCANCODE_UP] && keyState[SDL_SCANCODE_DOWN]) {
-        return UserInput::Action::NONE;
-    } else if (keyState[SDL_SCANCODE_LEFT] || keyState[SDL_SCANCODE_DOWN]) {
-        return UserInput::Action::MOVEDOWN;
-    } else if (keyState[SDL_SCANCODE_RIGHT] || keyState[SDL_SCANCODE_UP]) {
-        return UserInput::Action::MOVEUP;
-    }
-
-    return UserInput::Action::NONE;
-}
-
 /**
  * @brief draws timer with styled box
+ * @param snapshot Round state to draw
  */
-void FishingView::drawTimer() {
+void FishingView::drawTimer(RenderCommandBuffer& commands, const FishingSnapshot& snapshot) {
     // Calculate remaining time
-    int remainingTime = logicPtr->getRoundDuration() - logicPtr->getElapsedTime();
+    int remainingTime = snapshot.roundDuration - snapshot.elapsedTime;
     if (remainingTime < 0) remainingTime = 0;
     int secs = remainingTime/1000;
     
-    // Format time with padding for consistent display
-    std::ostringstream timerStream;
-    timerStream << "Time: " << std::setfill('0') << std::setw(2) << secs;
-    std::string timerText = timerStream.str();
+    // Format time with padding for consistent display; stack buffer, no per-frame allocation
+    char timerText[32];
+    std::snprintf(timerText, sizeof(timerText), "Time: %02d", secs);
     
     // Scale and position the box at top-left
     float boxWidthPercent = 0.15f;
@@ -501,22 +640,23 @@ void FishingView::drawTimer() {
     float boxXPercent = 0.02f;
     float boxYPercent = 0.02f;
     
-    int boxWidth = Scale::scaleW(boxWidthPercent);
-    int boxHeight = Scale::scaleH(boxHeightPercent);
-    int boxX = Scale::scaleX(boxXPercent);
-    int boxY = Scale::scaleY(boxYPercent);
+    int boxWidth = screen.scaleW(boxWidthPercent);
+    int boxHeight = screen.scaleH(boxHeightPercent);
+    int boxX = screen.scaleW(boxXPercent);
+    int boxY = screen.scaleH(boxYPercent);
     
     // Draw the styled box with timer text
-    drawStyledBox(boxX, boxY, boxWidth, boxHeight, timerText);
+    drawStyledBox(commands, boxX, boxY, boxWidth, boxHeight, timerText);
 }
 
 /** Moved down so I could compare with Timer
  * @brief draws scoreboard with styled box
  */
-void FishingView::drawScore()
+void FishingView::drawScore(RenderCommandBuffer& commands, const FishingSnapshot& snapshot)
 {
-    // Get the score as string
-    std::string scoreText = "Score: " + std::to_string(logicPtr->getCatchScore());
+    // Get the score as text
+    char scoreText[32];
+    std::snprintf(scoreText, sizeof(scoreText), "Score: %d", snapshot.catchScore);
     
     // Scale and position the box
     float boxWidthPercent = 0.15f;
@@ -524,13 +664,13 @@ void FishingView::drawScore()
     float boxXPercent = 0.02f;
     float boxYPercent = 0.09f;
     
-    int boxWidth = Scale::scaleW(boxWidthPercent);
-    int boxHeight = Scale::scaleH(boxHeightPercent);
-    int boxX = Scale::scaleX(boxXPercent);
-    int boxY = Scale::scaleY(boxYPercent);
+    int boxWidth = screen.scaleW(boxWidthPercent);
+    int boxHeight = screen.scaleH(boxHeightPercent);
+    int boxX = screen.scaleW(boxXPercent);
+    int boxY = screen.scaleH(boxYPercent);
 
     // Draw the styled box with score text
-    drawStyledBox(boxX, boxY, boxWidth, boxHeight, scoreText);
+    drawStyledBox(commands, boxX, boxY, boxWidth, boxHeight, scoreText);
 }
 
 /**
@@ -539,8 +679,8 @@ void FishingView::drawScore()
 void FishingView::updateResolution(float newWidth, float newHeight) {
     std::cout << "FishingView: Updating for resolution " << newWidth << "x" << newHeight << std::endl;
     // Update screen dimensions
-    screenW = newWidth;
-    screenH = newHeight;
+    screen = WorldMetrics::fromScreen(newWidth, newHeight);
+    scaledFontSize = Scale::scaleFontSize(Visuals::FONT_SIZE);
     pauseMenu.setScreenDimensions(newWidth, newHeight); // Pause menu scaling    
     loadSprites(); // Reload texturesif needed
 }
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include <cstdlib> // For malloc and free
+#include <cstdarg> // For format arguments
+#include <cstdio> // For vsnprintf
+#include <cstring> // For memcpy
+#include <cstdint> // For pointer alignment
+#include <algorithm> // For block sizing
+#include <new> // For bad_alloc
+
+#include "frame_arena.hpp" // Class header
+
+namespace
+{
+    char* allocateBlock(std::size_t bytes)
+    {
+        char* memory = static_cast<char*>(std::malloc(bytes));
+        if (!memory) {
+            throw std::bad_alloc();
+        }
+        return memory;
+    }
+
+    // Bytes to skip from base + offset to reach the alignment
+    std::size_t paddingFor(const char* base, std::size_t offset, std::size_t alignment)
+    {
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(base) + offset;
+        return (alignment - address % alignment) % alignment;
+    }
+}
+
+/**
+ * @brief Allocates the main block
+ * @param initialBytes Starting size; grows to fit the largest frame seen
+ */
+FrameArena::FrameArena(std::size_t initialBytes) :
+    block(allocateBlock(std::max<std::size_t>(initialBytes, 64))),
+    capacity(std::max<std::size_t>(initialBytes, 64)),
+    used(0),
+    overflowBlock(nullptr),
+    overflowCapacity(0),
+    overflowUsed(0),
+    overflowOffset(0),
+    highWater(0)
+{
+}
+
+FrameArena::~FrameArena()
+{
+    for (char* extra : overflow) {
+        std::free(extra);
+    }
+    std::free(block);
+}
+
+/**
+ * @brief Arena the game thread resets at the start of every frame
+ */
+FrameArena& FrameArena::perFrame()
+{
+    static FrameArena arena;
+    return arena;
+}
+
+/**
+ * @brief Takes bytes from the arena, valid until the next reset()
+ * @param bytes Size wanted
+ * @param alignment Power of two alignment
+ * @return void* aligned memory, never null
+ */
+void* FrameArena::allocate(std::size_t bytes, std::size_t alignment)
+{
+    if (overflowBlock == nullptr) {
+        std::size_t padding = paddingFor(block, used, alignment);
+        if (used + padding + bytes <= capacity) {
+            void* memory = block + used + padding;
+            used += padding + bytes;
+            return memory;
+        }
+    }
+    return allocateOverflow(bytes, alignment);
+}
+
+/**
+ * @brief Chains on another block when the main one is full
+ */
+void* FrameArena::allocateOverflow(std::size_t bytes, std::size_t alignment)
+{
+    std::size_t padding = overflowBlock ? paddingFor(overflowBlock, overflowOffset, alignment) : 0;
+    if (overflowBlock == nullptr || overflowOffset + padding + bytes > overflowCapacity) {
+        overflowCapacity = std::max(capacity, bytes + alignment);
+        overflowBlock = allocateBlock(overflowCapacity);
+        overflow.push_back(overflowBlock);
+        overflowOffset = 0;
+        padding = paddingFor(overflowBlock, 0, alignment);
+    }
+    void* memory = overflowBlock + overflowOffset + padding;
+    overflowOffset += padding + bytes;
+    overflowUsed += padding + bytes;
+    return memory;
+}
+
+/**
+ * @brief Releases everything handed out since the last reset
+ * @details If the frame spilled into overflow blocks, the main block is replaced by one
+ * that would have held the whole frame so the next one stays in a single block.
+ */
+void FrameArena::reset()
+{
+    std::size_t frameBytes = used + overflowUsed;
+    highWater = std::max(highWater, frameBytes);
+
+    if (!overflow.empty()) {
+        for (char* extra : overflow) {
+            std::free(extra);
+        }
+        overflow.clear();
+        overflowBlock = nullptr;
+        overflowCapacity = 0;
+        overflowOffset = 0;
+        overflowUsed = 0;
+
+        std::free(block);
+        capacity = std::max(capacity * 2, frameBytes + frameBytes / 2);
+        block = allocateBlock(capacity);
+    }
+    used = 0;
+}
+
+/**
+ * @brief Copies text into the arena as a null terminated string
+ * @param text Characters to copy, need not be terminated
+ * @param length Number of characters
+ * @return const char* copy valid until the next reset()
+ */
+const char* FrameArena::copy(const char* text, std::size_t length)
+{
+    char* memory = static_cast<char*>(allocate(length + 1, 1));
+    std::memcpy(memory, text, length);
+    memory[length] = '\0';
+    return memory;
+}
+
+/**
+ * @brief printf-style formatting into the arena
+ * @param fmt Format string
+ * @return const char* formatted text valid until the next reset()
+ */
+const char* FrameArena::format(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    va_list sizing;
+    va_copy(sizing, args);
+    int length = std::vsnprintf(nullptr, 0, fmt, sizing);
+    va_end(sizing);
+
+    if (length < 0) {
+        va_end(args);
+        return "";
+    }
+    char* memory = static_cast<char*>(allocate(static_cast<std::size_t>(length) + 1, 1));
+    std::vsnprintf(memory, static_cast<std::size_t>(length) + 1, fmt, args);
+    va_end(args);
+    return memory;
+}
@@ -0,0 +1,136 @@
+#include <algorithm> // For frame rate limits
+#include <iostream> // For pacing status messages
+
+#include "frame_pacer.hpp" // Class header
+
+/**
+ * @brief Sets up pacing; call detectDisplay() and rendererCreated() before the first frame
+ * @param mode How to wait between frames
+ * @param targetFps Frame rate to aim for, 0 to follow the display's refresh rate
+ */
+FramePacer::FramePacer(PacingMode mode, int targetFps) :
+    mode(mode),
+    requestedFps(std::max(0, targetFps)),
+    counterFrequency(SDL_GetPerformanceFrequency())
+{
+}
+
+/**
+ * @brief Reads the refresh rate of the display the window is on
+ * @param window Game window
+ */
+void FramePacer::detectDisplay(SDL_Window* window)
+{
+    SDL_DisplayMode displayMode;
+    int displayIndex = SDL_GetWindowDisplayIndex(window);
+    if (displayIndex >= 0 && SDL_GetCurrentDisplayMode(displayIndex, &displayMode) == 0 && displayMode.refresh_rate > 0) {
+        refreshRate = displayMode.refresh_rate;
+    } else {
+        std::cerr << "FramePacer: Could not read display refresh rate, assuming " << refreshRate << " Hz" << std::endl;
+    }
+    std::cout << "FramePacer: Display " << refreshRate << " Hz, target " << getTargetFps() << " fps" << std::endl;
+}
+
+/**
+ * @brief Frame rate the loop is paced to
+ * @return int frames per second, 0 when uncapped
+ */
+int FramePacer::getTargetFps() const
+{
+    switch (mode) {
+        case PacingMode::UNCAPPED:
+            return 0;
+        case PacingMode::POWER_SAVER:
+            return requestedFps ? std::min(requestedFps, 30) : std::max(1, std::min(refreshRate / 2, 30));
+        default:
+            return requestedFps ? requestedFps : refreshRate;
+    }
+}
+
+/**
+ * @brief Whether the renderer should be created with vsync
+ * @return true when presenting at the display rate is exactly the target
+ */
+bool FramePacer::wantsVsync() const
+{
+    return mode == PacingMode::AUTO && getTargetFps() == refreshRate;
+}
+
+/**
+ * @brief Checks whether the created renderer really presents with vsync
+ * @param renderer Renderer the game presents with
+ */
+void FramePacer::rendererCreated(SDL_Renderer* renderer)
+{
+    SDL_RendererInfo info;
+    vsyncActive = SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_PRESENTVSYNC);
+    if (wantsVsync() && !vsyncActive) {
+        std::cout << "FramePacer: Vsync unavailable, pacing with timers" << std::endl;
+    }
+}
+
+/**
+ * @brief Whether present already blocks to the target rate, so the pacer must not wait too
+ */
+bool FramePacer::trustsVsync() const
+{
+    return vsyncActive && wantsVsync() && shortVsyncFrames < MAX_SHORT_VSYNC_FRAMES;
+}
+
+/**
+ * @brief Call once per loop after the frame is presented; waits until the next frame is due
+ */
+void FramePacer::waitForNextFrame()
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    int targetFps = getTargetFps();
+
+    if (targetFps > 0 && !trustsVsync()) {
+        Uint64 period = counterFrequency / targetFps;
+        if (frameDeadline == 0) {
+            frameDeadline = now;
+        }
+        frameDeadline += period;
+        if (frameDeadline > now) {
+            waitUntil(frameDeadline);
+            now = SDL_GetPerformanceCounter();
+        } else {
+            frameDeadline = now; // Missed it; start over rather than rushing the next frames
+        }
+    }
+
+    if (lastFrameStart != 0) {
+        lastFrameMs = (now - lastFrameStart) * 1000.0 / counterFrequency;
+
+        // Hidden windows and some drivers return from a vsync present immediately
+        if (vsyncActive && wantsVsync() && shortVsyncFrames < MAX_SHORT_VSYNC_FRAMES) {
+            shortVsyncFrames = lastFrameMs < 500.0 / refreshRate ? shortVsyncFrames + 1 : 0;
+            if (shortVsyncFrames == MAX_SHORT_VSYNC_FRAMES) {
+                std::cout << "FramePacer: Vsync is not blocking, pacing with timers" << std::endl;
+                frameDeadline = now;
+            }
+        }
+    }
+    lastFrameStart = now;
+}
+
+/**
+ * @brief Sleeps most of the way to a deadline, then spins the rest (sleep only in power saver)
+ * @param deadline Performance counter value to wait for
+ */
+void FramePacer::waitUntil(Uint64 deadline) const
+{
+    Uint64 spinMargin = static_cast<Uint64>(SPIN_MARGIN_MS * counterFrequency / 1000.0);
+    Uint64 now = SDL_GetPerformanceCounter();
+    while (now < deadline) {
+        Uint64 remaining = deadline - now;
+        if (mode == PacingMode::POWER_SAVER) {
+            SDL_Delay(static_cast<Uint32>(std::max<Uint64>(1, remaining * 1000 / counterFrequency)));
+            return;
+        }
+        if (remaining > spinMargin) {
+            SDL_Delay(static_cast<Uint32>((remaining - spinMargin) * 1000 / counterFrequency));
+        }
+        now = SDL_GetPerformanceCounter();
+    }
+}
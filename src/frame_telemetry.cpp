@@ -0,0 +1,91 @@
+#include <algorithm> // For sorting samples
+#include <iomanip> // For report formatting
+
+#include "frame_telemetry.hpp" // Class header
+
+/**
+ * @brief Adds one frame's duration, from the pacer's high-resolution clock
+ * @param frameMs Frame time in ms
+ */
+void FrameTelemetry::recordFrame(double frameMs)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    frameTimes.push_back(frameMs);
+}
+
+/**
+ * @brief Adds one input-to-present latency sample; safe to call from the render thread
+ * @param latencyMs Event timestamp to present return, in ms
+ */
+void FrameTelemetry::recordInputLatency(Uint32 latencyMs)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    inputLatencies.push_back(latencyMs);
+}
+
+/**
+ * @brief Adds one sound effect's trigger-to-output latency, as measured by AudioEngine
+ * @param latencyMs trigger() call to the start of the buffer the sound is mixed into, in ms
+ */
+void FrameTelemetry::recordAudioLatency(double latencyMs)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    audioLatencies.push_back(latencyMs);
+}
+
+/**
+ * @brief Adds one fishing frame's replay time and the scene render scale it was drawn at
+ * @param replayMs Replay plus flush, see RenderCommandBuffer::replayTimed
+ * @param scale Share of the window's resolution the scene was drawn at
+ */
+void FrameTelemetry::recordRenderScale(double replayMs, float scale)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    sceneReplayTimes.push_back(replayMs);
+    renderScales.push_back(scale);
+}
+
+/**
+ * @brief Prints sample counts and percentiles for frame times, latencies and fishing render cost
+ * @param out Stream to print to
+ */
+void FrameTelemetry::report(std::ostream& out) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "Frame telemetry:" << std::endl;
+    printStats(out, "Frame ms", frameTimes);
+    printStats(out, "Input-to-photon ms", inputLatencies);
+    printStats(out, "Sound trigger-to-output ms", audioLatencies);
+    printStats(out, "Fishing replay ms", sceneReplayTimes);
+    printStats(out, "Fishing render scale", renderScales);
+}
+
+/**
+ * @brief Prints one sample set's mean, p50, p95, p99 and max
+ * @param samples Copy to sort
+ */
+void FrameTelemetry::printStats(std::ostream& out, const char* label, std::vector<double> samples)
+{
+    out << "  " << label << ": ";
+    if (samples.empty()) {
+        out << "no samples" << std::endl;
+        return;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    double total = 0;
+    for (double sample : samples) {
+        total += sample;
+    }
+    auto percentile = [&samples](double p) {
+        return samples[static_cast<size_t>(p * (samples.size() - 1))];
+    };
+
+    out << std::fixed << std::setprecision(2)
+        << "n " << samples.size()
+        << "  mean " << total / samples.size()
+        << "  p50 " << percentile(0.50)
+        << "  p95 " << percentile(0.95)
+        << "  p99 " << percentile(0.99)
+        << "  max " << samples.back() << std::endl;
+}
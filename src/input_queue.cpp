@@ -0,0 +1,101 @@
+#include "input_queue.hpp" // Class header
+
+/**
+ * @brief Queues a one-shot action (release, start)
+ * @param timestamp SDL event timestamp in ms
+ * @param action Action to apply on the tick covering timestamp
+ */
+void InputQueue::pushAction(Uint32 timestamp, UserInput::Action action)
+{
+    pending.push_back({timestamp, action, 0, false});
+}
+
+/**
+ * @brief Queues a direction key press or release; other keys are ignored
+ * @param timestamp SDL event timestamp in ms
+ * @param key Scancode from the key event
+ * @param down true for key down, false for key up
+ */
+void InputQueue::pushKey(Uint32 timestamp, SDL_Scancode key, bool down)
+{
+    unsigned int bit = keyBitFor(key);
+    if (bit != 0) {
+        pending.push_back({timestamp, UserInput::Action::NONE, bit, down});
+    }
+}
+
+/**
+ * @brief Applies every input stamped at or before a tick
+ * @param tickTime Time the tick simulates up to, in SDL ms
+ * @param actions Receives the one-shot actions in order (appended)
+ * @return Uint32 timestamp of the oldest input applied, 0 if none
+ */
+Uint32 InputQueue::drain(Uint32 tickTime, std::vector<UserInput::Action>& actions)
+{
+    Uint32 oldest = 0;
+    while (!pending.empty() && !SDL_TICKS_PASSED(pending.front().timestamp, tickTime + 1)) {
+        const TimedInput& input = pending.front();
+        if (oldest == 0) {
+            oldest = input.timestamp;
+        }
+        if (input.keyBit != 0) {
+            heldKeys = input.down ? (heldKeys | input.keyBit) : (heldKeys & ~input.keyBit);
+        } else {
+            actions.push_back(input.action);
+        }
+        pending.pop_front();
+    }
+    return oldest;
+}
+
+/**
+ * @brief Rod direction from the held keys, opposing keys cancel out
+ * @return UserInput::Action MOVEUP, MOVEDOWN or NONE
+ */
+UserInput::Action InputQueue::heldDirection() const
+{
+    bool left = heldKeys & KEY_LEFT;
+    bool right = heldKeys & KEY_RIGHT;
+    bool up = heldKeys & KEY_UP;
+    bool down = heldKeys & KEY_DOWN;
+
+    if ((left && right) || (up && down)) {
+        return UserInput::Action::NONE;
+    } else if (left || down) {
+        return UserInput::Action::MOVEDOWN;
+    } else if (right || up) {
+        return UserInput::Action::MOVEUP;
+    }
+    return UserInput::Action::NONE;
+}
+
+/**
+ * @brief Drops pending input and takes held keys from the keyboard state, e.g. when a round starts
+ * @param keyState Array from SDL_GetKeyboardState
+ */
+void InputQueue::resync(const Uint8* keyState)
+{
+    pending.clear();
+    heldKeys = 0;
+    for (SDL_Scancode key : {SDL_SCANCODE_UP, SDL_SCANCODE_DOWN, SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT}) {
+        if (keyState[key]) {
+            heldKeys |= keyBitFor(key);
+        }
+    }
+}
+
+unsigned int InputQueue::keyBitFor(SDL_Scancode key)
+{
+    switch (key) {
+        case SDL_SCANCODE_UP:
+            return KEY_UP;
+        case SDL_SCANCODE_DOWN:
+            return KEY_DOWN;
+        case SDL_SCANCODE_LEFT:
+            return KEY_LEFT;
+        case SDL_SCANCODE_RIGHT:
+            return KEY_RIGHT;
+        default:
+            return 0;
+    }
+}
@@ -0,0 +1,276 @@
+#include <iostream> // For configuration errors
+
+#include "job_system.hpp" // Class header
+
+namespace
+{
+    // Which pool, if any, the current thread works for, and its queue there
+    thread_local const JobSystem* currentSystem = nullptr;
+    thread_local int currentQueueIndex = 0;
+
+    // Worker count for shared(), fixed once it starts
+    int sharedThreads = 0;
+    std::atomic<bool> sharedStarted(false);
+
+    int startShared()
+    {
+        sharedStarted = true;
+        return sharedThreads;
+    }
+}
+
+/**
+ * @brief Pushes a job onto the owner's end
+ * @return bool false if the ring is full
+ */
+bool JobSystem::WorkQueue::push(const Job& job)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (back - front == QUEUE_CAPACITY) {
+        return false;
+    }
+    jobs[back % QUEUE_CAPACITY] = job;
+    back++;
+    return true;
+}
+
+/**
+ * @brief Takes the newest job, for the owning thread
+ */
+bool JobSystem::WorkQueue::pop(Job& job)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (front == back) {
+        return false;
+    }
+    back--;
+    job = jobs[back % QUEUE_CAPACITY];
+    return true;
+}
+
+/**
+ * @brief Takes the oldest job, for other threads
+ */
+bool JobSystem::WorkQueue::steal(Job& job)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (front == back) {
+        return false;
+    }
+    job = jobs[front % QUEUE_CAPACITY];
+    front++;
+    return true;
+}
+
+/**
+ * @brief Starts the workers
+ * @param threads Worker threads, 0 for one per core besides the caller's
+ */
+JobSystem::JobSystem(int threads) :
+    queuedJobs(0),
+    sleepingWorkers(0),
+    stopping(false)
+{
+    if (threads <= 0) {
+        threads = std::max(0, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    }
+    for (int i = 0; i <= threads; i++) {
+        queues.emplace_back(new WorkQueue());
+    }
+    for (int i = 1; i <= threads; i++) {
+        workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+/**
+ * @brief Stops and joins the workers; jobs still queued are dropped
+ */
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Pool shared by the whole game, started on first use
+ */
+JobSystem& JobSystem::shared()
+{
+    static JobSystem system(startShared());
+    return system;
+}
+
+/**
+ * @brief Sets how many workers shared() starts with; call before anything uses it
+ * @param threads Worker threads, 0 for one per core besides the caller's
+ * @return bool false if the shared pool is already running
+ */
+bool JobSystem::configureShared(int threads)
+{
+    if (sharedStarted) {
+        std::cerr << "JobSystem: Shared pool already started with " << shared().getWorkerCount() << " workers" << std::endl;
+        return false;
+    }
+    sharedThreads = threads;
+    return true;
+}
+
+/**
+ * @brief Queues a job on the calling thread's queue
+ * @param function Job body
+ * @param data Passed to function; must stay valid until the job has run
+ * @param counter Incremented now and decremented when the job finishes, may be nullptr
+ */
+void JobSystem::submit(JobFunction function, void* data, JobCounter* counter)
+{
+    if (counter) {
+        counter->pending.fetch_add(1);
+    }
+    enqueue({function, data, counter, AllocTracker::threadAccount()});
+}
+
+/**
+ * @brief Queues a job that may only start once another counter reaches zero
+ * @param dependency Counter to wait for
+ * @param function Job body
+ * @param data Passed to function
+ * @param counter Incremented now and decremented when the job finishes, may be nullptr
+ */
+void JobSystem::submitAfter(JobCounter& dependency, JobFunction function, void* data, JobCounter* counter)
+{
+    if (counter) {
+        counter->pending.fetch_add(1);
+    }
+    Job job = {function, data, counter, AllocTracker::threadAccount()};
+    {
+        std::lock_guard<std::mutex> lock(dependency.mutex);
+        if (!dependency.done() && dependency.continuationCount < JobCounter::MAX_CONTINUATIONS) {
+            dependency.continuations[dependency.continuationCount++] = job;
+            return;
+        }
+    }
+    wait(dependency); // Already done, or no room to park the job
+    enqueue(job);
+}
+
+/**
+ * @brief Runs queued jobs on the calling thread until the counter reaches zero
+ * @param counter Counter to wait for
+ */
+void JobSystem::wait(const JobCounter& counter)
+{
+    while (!counter.done()) {
+        if (!runOneJob()) {
+            std::this_thread::yield(); // The last jobs are running elsewhere
+        }
+    }
+}
+
+/**
+ * @brief Puts a ready job on this thread's queue and wakes a worker for it
+ */
+void JobSystem::enqueue(const Job& job)
+{
+    if (!queues[currentQueue()]->push(job)) {
+        run(job); // Queue full: run it here rather than allocate
+        finish(job);
+        return;
+    }
+    queuedJobs.fetch_add(1);
+    if (sleepingWorkers.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wakeUp.notify_one();
+    }
+}
+
+/**
+ * @brief Runs a job, charging what it allocates to the thread that submitted it
+ */
+void JobSystem::run(const Job& job)
+{
+    AllocCharge charge(job.account);
+    job.function(job.data);
+}
+
+/**
+ * @brief Runs one job, from this thread's queue first, otherwise stolen from another
+ * @return bool false if every queue was empty
+ */
+bool JobSystem::runOneJob()
+{
+    int own = currentQueue();
+    Job job;
+    bool found = queues[own]->pop(job);
+    for (size_t i = 1; !found && i < queues.size(); i++) {
+        found = queues[(own + i) % queues.size()]->steal(job);
+    }
+    if (!found) {
+        return false;
+    }
+    queuedJobs.fetch_sub(1);
+    run(job);
+    finish(job);
+    return true;
+}
+
+/**
+ * @brief Counts a job as done and releases anything waiting on its counter
+ */
+void JobSystem::finish(const Job& job)
+{
+    JobCounter* counter = job.counter;
+    if (!counter) {
+        return;
+    }
+
+    // Nothing may touch the counter after the lock is released: its owner can see zero and destroy it
+    Job ready[JobCounter::MAX_CONTINUATIONS];
+    int readyCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(counter->mutex);
+        if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            readyCount = counter->continuationCount;
+            for (int i = 0; i < readyCount; i++) {
+                ready[i] = counter->continuations[i];
+            }
+            counter->continuationCount = 0;
+        }
+    }
+    for (int i = 0; i < readyCount; i++) {
+        enqueue(ready[i]);
+    }
+}
+
+/**
+ * @brief Queue the calling thread pushes to: its own as a worker, otherwise the shared one
+ */
+int JobSystem::currentQueue() const
+{
+    return currentSystem == this ? currentQueueIndex : 0;
+}
+
+/**
+ * @brief Worker body: run and steal jobs, sleep when there are none
+ * @param queue This worker's queue index
+ */
+void JobSystem::workerLoop(int queue)
+{
+    currentSystem = this;
+    currentQueueIndex = queue;
+
+    while (!stopping.load()) {
+        if (runOneJob()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepingWorkers.fetch_add(1);
+        wakeUp.wait(lock, [this] { return stopping.load() || queuedJobs.load() > 0; });
+        sleepingWorkers.fetch_sub(1);
+    }
+}
@@ -0,0 +1,83 @@
+#include "lane_scheduler.hpp" // Class header
+
+/**
+ * @brief Creates an empty scheduler
+ * @param threads Threads besides the caller to spread lanes over, 0 uses the whole shared pool
+ */
+LaneScheduler::LaneScheduler(int threads) :
+    threadLimit(threads > 0 ? threads + 1 : 0)
+{
+}
+
+/**
+ * @brief Adds a lane; call before the first tick
+ * @param logic Round to tick, already set running and spawned
+ * @param bot Bot playing the lane, nullptr to take input from setInput
+ * @return int lane index
+ */
+int LaneScheduler::addLane(const std::shared_ptr<FishingLogic>& logic, std::unique_ptr<Bot> bot)
+{
+    std::unique_ptr<Lane> lane(new Lane());
+    lane->logic = logic;
+    lane->bot = std::move(bot);
+    lanes.push_back(std::move(lane));
+    return static_cast<int>(lanes.size()) - 1;
+}
+
+/**
+ * @brief Sets the input applied to a player-driven lane on the next tick
+ * @param lane Lane index
+ * @param action Input for the next tick
+ */
+void LaneScheduler::setInput(int lane, UserInput::Action action)
+{
+    lanes[lane]->input = action;
+}
+
+/**
+ * @brief Updates every lane once across the job system and waits for all of them
+ * @param frameMs Milliseconds to advance headless lanes' clocks, 0 to leave them
+ */
+void LaneScheduler::tick(Uint32 frameMs)
+{
+    currentFrameMs = frameMs;
+    JobSystem::shared().parallelFor(static_cast<int>(lanes.size()), 1, [this](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            tickLane(*lanes[i]);
+        }
+    }, threadLimit);
+}
+
+/**
+ * @brief Whether every lane's round has stopped running
+ * @return bool true when no lane is still running
+ */
+bool LaneScheduler::allFinished() const
+{
+    for (const auto& lane : lanes) {
+        if (lane->logic->getRunning()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Applies one tick of input and update to a lane; update() publishes its snapshot
+ * @param lane Lane to tick
+ */
+void LaneScheduler::tickLane(Lane& lane)
+{
+    FishingLogic& logic = *lane.logic;
+    if (logic.getRunning() && !logic.isPaused()) {
+        if (lane.bot) {
+            logic.observe(lane.observation);
+            lane.input = lane.bot->nextAction(lane.observation);
+        }
+        logic.handleUserInput(lane.input);
+        logic.update();
+        if (currentFrameMs > 0) {
+            logic.advanceClock(currentFrameMs);
+        }
+    }
+}
@@ -0,0 +1,252 @@
+#include <iostream> // For load errors
+#include <fstream> // For table file
+#include <sstream> // For row parsing
+#include <algorithm> // For clamping
+
+#include "level_config.hpp" // Class header
+#include "game_constants.hpp" // For built-in level values and caps
+
+namespace
+{
+    /**
+     * @brief Clamp a spawn count to the valid range
+     * @param count Raw count
+     * @return int count between 0 and Game::MAX_FLOATERS_PER_TYPE
+     */
+    int clampCount(int count)
+    {
+        return std::max(0, std::min(count, Game::MAX_FLOATERS_PER_TYPE));
+    }
+
+    /**
+     * @brief Clamp a hazard speed multiplier to the valid range
+     * @param multiplier Raw multiplier
+     * @return float multiplier between 0.1 and Game::MAX_HAZARD_SPEED_MULTIPLIER
+     */
+    float clampSpeed(float multiplier)
+    {
+        return std::max(0.1f, std::min(multiplier, Game::MAX_HAZARD_SPEED_MULTIPLIER));
+    }
+
+    /**
+     * @brief Raises a level with no fish at all to one small fish, since a round needs something to spawn
+     * @param params Level to fix up
+     * @return bool true if the level had to be raised
+     */
+    bool requireFish(LevelParams& params)
+    {
+        if (params.smallFish + params.mediumFish + params.bigFish > 0) {
+            return false;
+        }
+        params.smallFish = 1;
+        return true;
+    }
+}
+
+/**
+ * @brief Builds the default table from the compiled-in Level:: values
+ */
+LevelTable::LevelTable()
+{
+    days = {
+        {Level::Day1::SMALL_FISH, Level::Day1::MEDIUM_FISH, Level::Day1::BIG_FISH,
+         Level::Day1::NORMAL_HAZARDS, Level::Day1::HEAVY_HAZARDS, Level::Day1::SHOCK_HAZARDS,
+         Level::Day1::HAZARD_SPEED_MULTIPLIER},
+        {Level::Day2::SMALL_FISH, Level::Day2::MEDIUM_FISH, Level::Day2::BIG_FISH,
+         Level::Day2::NORMAL_HAZARDS, Level::Day2::HEAVY_HAZARDS, Level::Day2::SHOCK_HAZARDS,
+         Level::Day2::HAZARD_SPEED_MULTIPLIER},
+        {Level::Day3::SMALL_FISH, Level::Day3::MEDIUM_FISH, Level::Day3::BIG_FISH,
+         Level::Day3::NORMAL_HAZARDS, Level::Day3::HEAVY_HAZARDS, Level::Day3::SHOCK_HAZARDS,
+         Level::Day3::HAZARD_SPEED_MULTIPLIER},
+        {Level::Day4::SMALL_FISH, Level::Day4::MEDIUM_FISH, Level::Day4::BIG_FISH,
+         Level::Day4::NORMAL_HAZARDS, Level::Day4::HEAVY_HAZARDS, Level::Day4::SHOCK_HAZARDS,
+         Level::Day4::HAZARD_SPEED_MULTIPLIER},
+        {Level::Day5::SMALL_FISH, Level::Day5::MEDIUM_FISH, Level::Day5::BIG_FISH,
+         Level::Day5::NORMAL_HAZARDS, Level::Day5::HEAVY_HAZARDS, Level::Day5::SHOCK_HAZARDS,
+         Level::Day5::HAZARD_SPEED_MULTIPLIER},
+        {Level::Day6::SMALL_FISH, Level::Day6::MEDIUM_FISH, Level::Day6::BIG_FISH,
+         Level::Day6::NORMAL_HAZARDS, Level::Day6::HEAVY_HAZARDS, Level::Day6::SHOCK_HAZARDS,
+         Level::Day6::HAZARD_SPEED_MULTIPLIER},
+        {Level::Day7::SMALL_FISH, Level::Day7::MEDIUM_FISH, Level::Day7::BIG_FISH,
+         Level::Day7::NORMAL_HAZARDS, Level::Day7::HEAVY_HAZARDS, Level::Day7::SHOCK_HAZARDS,
+         Level::Day7::HAZARD_SPEED_MULTIPLIER},
+        {Level::Day8::SMALL_FISH, Level::Day8::MEDIUM_FISH, Level::Day8::BIG_FISH,
+         Level::Day8::NORMAL_HAZARDS, Level::Day8::HEAVY_HAZARDS, Level::Day8::SHOCK_HAZARDS,
+         Level::Day8::HAZARD_SPEED_MULTIPLIER},
+        {Level::Day9::SMALL_FISH, Level::Day9::MEDIUM_FISH, Level::Day9::BIG_FISH,
+         Level::Day9::NORMAL_HAZARDS, Level::Day9::HEAVY_HAZARDS, Level::Day9::SHOCK_HAZARDS,
+         Level::Day9::HAZARD_SPEED_MULTIPLIER},
+        {Level::Day10::SMALL_FISH, Level::Day10::MEDIUM_FISH, Level::Day10::BIG_FISH,
+         Level::Day10::NORMAL_HAZARDS, Level::Day10::HEAVY_HAZARDS, Level::Day10::SHOCK_HAZARDS,
+         Level::Day10::HAZARD_SPEED_MULTIPLIER}
+    };
+}
+
+/**
+ * @brief Shared level table for the running game
+ * @return reference to the process-wide table
+ */
+LevelTable& LevelTable::global()
+{
+    static LevelTable table;
+    return table;
+}
+
+/**
+ * @brief Replaces the table with the rows in a level file
+ * @param filename Path to the level table
+ * @return bool true if the file was read and had at least one valid row
+ * @details On failure the current table is kept, so a missing file falls back to the defaults
+ */
+bool LevelTable::loadFromFile(const std::string& filename)
+{
+    std::ifstream tableFile(filename);
+    if (!tableFile.is_open()) {
+        std::cerr << "LevelTable: Failed to open " << filename << ", using built-in levels" << std::endl;
+        return false;
+    }
+
+    bool success = parse(tableFile);
+    if (success) {
+        std::cout << "LevelTable: Loaded " << days.size() << " days from " << filename << std::endl;
+    }
+    return success;
+}
+
+/**
+ * @brief Parses a level table from a stream
+ * @param in Stream with one row per day: day small medium big normal heavy shock speed
+ * @return bool true if at least one valid row was read
+ * @details Blank lines and lines starting with '#' are skipped.  Days must be listed in
+ * order starting at 1; a gap or malformed row rejects the whole table.  Counts are clamped
+ * to the caps, and a row with no fish at all gets one small fish so its rounds can spawn.
+ */
+bool LevelTable::parse(std::istream& in)
+{
+    std::vector<LevelParams> parsed;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(in, line)) {
+        lineNumber++;
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+
+        std::istringstream row(line);
+        int day = 0;
+        LevelParams params;
+        if (!(row >> day >> params.smallFish >> params.mediumFish >> params.bigFish
+                  >> params.normalHazards >> params.heavyHazards >> params.shockHazards
+                  >> params.hazardSpeedMultiplier)) {
+            std::cerr << "LevelTable: Malformed row on line " << lineNumber << ": " << line << std::endl;
+            return false;
+        }
+
+        if (day != static_cast<int>(parsed.size()) + 1) {
+            std::cerr << "LevelTable: Expected day " << parsed.size() + 1 << " on line " << lineNumber
+                      << " but found day " << day << std::endl;
+            return false;
+        }
+
+        params.smallFish = clampCount(params.smallFish);
+        params.mediumFish = clampCount(params.mediumFish);
+        params.bigFish = clampCount(params.bigFish);
+        params.normalHazards = clampCount(params.normalHazards);
+        params.heavyHazards = clampCount(params.heavyHazards);
+        params.shockHazards = clampCount(params.shockHazards);
+        params.hazardSpeedMultiplier = clampSpeed(params.hazardSpeedMultiplier);
+        if (requireFish(params)) {
+            std::cerr << "LevelTable: Day " << day << " on line " << lineNumber << " has no fish, using one small fish" << std::endl;
+        }
+        parsed.push_back(params);
+    }
+
+    if (parsed.empty()) {
+        std::cerr << "LevelTable: No level rows found" << std::endl;
+        return false;
+    }
+
+    days = parsed;
+    return true;
+}
+
+/**
+ * @brief Gets the parameters for a day, extrapolating past the end of the table
+ * @param dayCount Current day number (1+)
+ * @return LevelParams for that day
+ */
+LevelParams LevelTable::getLevel(int dayCount) const
+{
+    int lastDay = static_cast<int>(days.size());
+    if (dayCount <= 1) {
+        return days.front();
+    }
+    if (dayCount <= lastDay) {
+        return days[dayCount - 1];
+    }
+    if (lastDay == 1) {
+        return days.back(); // No trend to extrapolate from
+    }
+
+    // Continue the growth between the last two rows, never shrinking the level
+    const LevelParams& last = days[lastDay - 1];
+    const LevelParams& prev = days[lastDay - 2];
+    int extraDays = dayCount - lastDay;
+
+    LevelParams params;
+    params.smallFish = clampCount(last.smallFish + std::max(0, last.smallFish - prev.smallFish) * extraDays);
+    params.mediumFish = clampCount(last.mediumFish + std::max(0, last.mediumFish - prev.mediumFish) * extraDays);
+    params.bigFish = clampCount(last.bigFish + std::max(0, last.bigFish - prev.bigFish) * extraDays);
+    params.normalHazards = clampCount(last.normalHazards + std::max(0, last.normalHazards - prev.normalHazards) * extraDays);
+    params.heavyHazards = clampCount(last.heavyHazards + std::max(0, last.heavyHazards - prev.heavyHazards) * extraDays);
+    params.shockHazards = clampCount(last.shockHazards + std::max(0, last.shockHazards - prev.shockHazards) * extraDays);
+
+    float speedStep = std::max(0.0f, last.hazardSpeedMultiplier - prev.hazardSpeedMultiplier);
+    params.hazardSpeedMultiplier = clampSpeed(last.hazardSpeedMultiplier + speedStep * extraDays);
+    requireFish(params);
+    return params;
+}
+
+/**
+ * @brief Overrides a single day, growing the table if needed
+ * @param dayCount Day to set (1+); days between the old end and this one copy the old last row
+ * @param params New parameters for the day; a day with no fish gets one small fish
+ */
+void LevelTable::setLevel(int dayCount, const LevelParams& params)
+{
+    if (dayCount < 1) {
+        return;
+    }
+    while (static_cast<int>(days.size()) < dayCount) {
+        days.push_back(days.back());
+    }
+    days[dayCount - 1] = params;
+    requireFish(days[dayCount - 1]);
+}
+
+/**
+ * @brief Generates a random variant of a level for balance sweeps
+ * @param base Level to perturb
+ * @param rng Caller-owned generator so sweeps stay reproducible per seed
+ * @param jitter Maximum relative change for each value (0.25 = +/- 25%)
+ * @return LevelParams jittered copy of base
+ */
+LevelParams LevelTable::makeVariant(const LevelParams& base, std::mt19937& rng, float jitter)
+{
+    std::uniform_real_distribution<float> scale(1.0f - jitter, 1.0f + jitter);
+    auto jitterCount = [&](int count) {
+        return clampCount(static_cast<int>(count * scale(rng) + 0.5f));
+    };
+
+    LevelParams variant;
+    variant.smallFish = std::max(1, jitterCount(base.smallFish)); // Always at least one fish to catch
+    variant.mediumFish = jitterCount(base.mediumFish);
+    variant.bigFish = jitterCount(base.bigFish);
+    variant.normalHazards = jitterCount(base.normalHazards);
+    variant.heavyHazards = jitterCount(base.heavyHazards);
+    variant.shockHazards = jitterCount(base.shockHazards);
+    variant.hazardSpeedMultiplier = clampSpeed(base.hazardSpeedMultiplier * scale(rng));
+    return variant;
+}
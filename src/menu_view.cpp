@@ -47,6 +47,8 @@ MenuView::MenuView(const shared_ptr<GameNotifier>& notifier, SDL_Window* window,
         if (!textureManager.loadTexture(Resource::BG_MENU_ANIM2_ID, Resource::BG_MENU_ANIM2)) {
             std::cerr << "Failed to load menu background animation frame 2" << std::endl;
         }
+        backgroundAnimation = textureManager.addAnimation(Resource::BG_MENU_ANIM1_ID, Resource::BG_MENU_ANIM2_ID,
+            Game::BACKGROUND_ANIMATION_DELAY);
     }
 
 MenuView::~MenuView() {
@@ -198,31 +200,24 @@ void MenuView::mouseClick(float x, float y) {
     }
 }
 
-void MenuView::renderMenu() {    
+void MenuView::renderMenu(RenderCommandBuffer& commands) {    
     // Render buttons
-    storeButton.renderBox(renderer, color);
-    loadGameButton.renderBox(renderer, color);
-    exitButton.renderBox(renderer, color);
+    storeButton.renderBox(commands, color);
+    loadGameButton.renderBox(commands, color);
+    exitButton.renderBox(commands, color);
 
-    smallResButton.renderBox(renderer, color);
-    medResButton.renderBox(renderer, color);
-    largeResButton.renderBox(renderer, color);
+    smallResButton.renderBox(commands, color);
+    medResButton.renderBox(commands, color);
+    largeResButton.renderBox(commands, color);
 }
 
-void MenuView::render() {
-    SDL_SetRenderDrawColor(renderer, 0, 40, 100, 255);
-    SDL_RenderClear(renderer);
+void MenuView::render(RenderCommandBuffer& commands) {
+    commands.clear({0, 40, 100, 255});
 
     // Use animated background instead of static
-    textureManager.drawAnimatedTexture(
-        Resource::BG_MENU_ID,
-        Resource::BG_MENU_ANIM1_ID,
-        Resource::BG_MENU_ANIM2_ID,
-        0, 0, Dimens::SCREEN_W, Dimens::SCREEN_H,
-        Game::BACKGROUND_ANIMATION_DELAY
-    );
+    textureManager.drawAnimatedTexture(commands, backgroundAnimation, 0, 0, Dimens::SCREEN_W, Dimens::SCREEN_H);
     
-    renderMenu();
+    renderMenu(commands);
 }
 
 
@@ -239,10 +234,6 @@ void MenuView::handleResolutionChange(int width, int height) {
  */
 void MenuView::updateResolution() {
     std::cout << "MenuView: Updating for resolution " << Dimens::SCREEN_W << "x" << Dimens::SCREEN_H << std::endl;
-    for (auto& pair : textureCache) {
-        SDL_DestroyTexture(pair.second);
-    }
-    textureCache.clear();
     
     // Update textbox positions
     storeButton.updateScreenPosition();
@@ -0,0 +1,389 @@
+#include <algorithm> // For block lengths and gain ramps
+#include <chrono> // For the decoder's refill period
+#include <cstring> // For WAV chunk ids
+#include <iostream> // For device and file messages
+#include <string> // For track paths
+
+#include "music_player.hpp" // Class header
+#include "game_constants.hpp" // For track paths
+
+namespace
+{
+    const float VOLUME = 0.5f;   // Leaves headroom for sound effects
+    const int REFILL_MS = 10;    // Decoder wake-up when nothing is requested; rings hold far more
+
+    /**
+     * @struct WavFormat
+     * @brief What readWavHeader() found
+     */
+    struct WavFormat
+    {
+        Uint16 encoding = 0;    // 1 is PCM
+        Uint16 channels = 0;
+        Uint32 rate = 0;
+        Uint16 bits = 0;
+        Sint64 dataStart = 0;
+        Uint32 dataLength = 0;
+    };
+
+    const std::string& trackPath(MusicTrack track)
+    {
+        switch (track) {
+            case MusicTrack::STORE:
+                return Resource::MUSIC_STORE;
+            case MusicTrack::FISHING:
+                return Resource::MUSIC_FISHING;
+            default:
+                return Resource::MUSIC_MENU;
+        }
+    }
+
+    /**
+     * @brief Walks a RIFF file's chunks up to the sample data
+     * @param file Opened at its start; left at the first sample
+     * @param format Filled in from the fmt and data chunks
+     * @return bool false if this is not a WAV file or has no data
+     */
+    bool readWavHeader(SDL_RWops* file, WavFormat& format)
+    {
+        char id[4];
+        if (SDL_RWread(file, id, sizeof(id), 1) != 1 || std::memcmp(id, "RIFF", 4) != 0) {
+            return false;
+        }
+        SDL_ReadLE32(file); // File length
+        if (SDL_RWread(file, id, sizeof(id), 1) != 1 || std::memcmp(id, "WAVE", 4) != 0) {
+            return false;
+        }
+
+        bool haveFormat = false;
+        while (SDL_RWread(file, id, sizeof(id), 1) == 1) {
+            Uint32 size = SDL_ReadLE32(file);
+            if (std::memcmp(id, "fmt ", 4) == 0 && size >= 16) {
+                format.encoding = SDL_ReadLE16(file);
+                format.channels = SDL_ReadLE16(file);
+                format.rate = SDL_ReadLE32(file);
+                SDL_ReadLE32(file); // Bytes per second
+                SDL_ReadLE16(file); // Block alignment
+                format.bits = SDL_ReadLE16(file);
+                SDL_RWseek(file, size - 16 + (size & 1), RW_SEEK_CUR);
+                haveFormat = true;
+            } else if (std::memcmp(id, "data", 4) == 0) {
+                format.dataStart = SDL_RWtell(file);
+                format.dataLength = size;
+                return haveFormat;
+            } else if (SDL_RWseek(file, size + (size & 1), RW_SEEK_CUR) < 0) {
+                return false;
+            }
+        }
+        return false;
+    }
+}
+
+MusicPlayer::~MusicPlayer()
+{
+    close();
+}
+
+/**
+ * @brief Starts the decoder thread and hooks the music mixer; the audio device must already be open
+ * @return bool false if the device is closed or not 16-bit stereo; the game plays without music then
+ */
+bool MusicPlayer::open()
+{
+    if (opened) {
+        return true;
+    }
+    Uint16 format = 0;
+    int channels = 0;
+    if (!Mix_QuerySpec(&frequency, &format, &channels)) {
+        std::cerr << "MusicPlayer: Audio device is not open" << std::endl;
+        return false;
+    }
+    if (format != AUDIO_S16SYS || channels != 2) {
+        std::cerr << "MusicPlayer: Music needs a 16-bit stereo device" << std::endl;
+        return false;
+    }
+
+    fadeStep = 1000.0f / (static_cast<float>(CROSSFADE_MS) * frequency);
+    for (std::unique_ptr<SampleRing>& ring : rings) {
+        ring = std::make_unique<SampleRing>();
+    }
+    requested.store(static_cast<int>(MusicTrack::NONE));
+    routing.store(0);
+    routingSeen.store(0);
+    stopping = false;
+    decoder = std::thread(&MusicPlayer::decodeLoop, this);
+    Mix_HookMusic(&MusicPlayer::hook, this);
+
+    opened = true;
+    std::cout << "MusicPlayer: Streaming music with " << CROSSFADE_MS << " ms crossfades" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Unhooks the mixer, stops the decoder thread and closes the tracks
+ */
+void MusicPlayer::close()
+{
+    if (!opened) {
+        return;
+    }
+    Mix_HookMusic(nullptr, nullptr); // Takes the audio lock, so no callback is still reading the rings
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    decoder.join();
+
+    for (int d = 0; d < DECKS; d++) {
+        closeTrack(decks[d]);
+        rings[d].reset();
+        gains[d] = 0.0f;
+        audible[d].store(false);
+    }
+    if (underruns.load() > 0) {
+        std::cout << "MusicPlayer: " << underruns.load() << " buffer underrun(s)" << std::endl;
+    }
+    opened = false;
+}
+
+/**
+ * @brief Crossfades to a track, or out to silence for NONE; never waits on the disk
+ * @param track Track to loop from now on
+ */
+void MusicPlayer::play(MusicTrack track)
+{
+    if (!opened) {
+        return;
+    }
+    requested.store(static_cast<int>(track), std::memory_order_release);
+    wake.notify_one();
+}
+
+/**
+ * @brief SDL_mixer music hook, on the audio thread with the audio lock held
+ */
+void MusicPlayer::hook(void* player, Uint8* stream, int length)
+{
+    static_cast<MusicPlayer*>(player)->mix(reinterpret_cast<Sint16*>(stream), length / static_cast<int>(sizeof(Sint16)));
+}
+
+/**
+ * @brief Adds both decks into the buffer, moving their gains toward the routed deck
+ * @param out Device buffer, interleaved stereo 16-bit samples
+ * @param samples Samples in the buffer, both channels
+ */
+void MusicPlayer::mix(Sint16* out, int samples)
+{
+    uint32_t current = routing.load(std::memory_order_acquire);
+    int routed = static_cast<int>(current & 3) - 1;
+
+    for (int d = 0; d < DECKS; d++) {
+        if (d != routed && gains[d] <= 0.0f) {
+            continue;
+        }
+        float target = d == routed ? 1.0f : 0.0f;
+        float gain = gains[d];
+        for (int done = 0; done < samples; done += MIX_SAMPLES) {
+            int count = samples - done < MIX_SAMPLES ? samples - done : MIX_SAMPLES;
+            int got = static_cast<int>(rings[d]->popSome(mixBuffer, count));
+            if (got < count) {
+                std::fill(mixBuffer + got, mixBuffer + count, 0);
+                if (d == routed) {
+                    underruns.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            // One gain step per stereo frame
+            for (int i = 0; i + 1 < count; i += 2) {
+                gain = gain < target ? std::min(target, gain + fadeStep) : std::max(target, gain - fadeStep);
+                float level = gain * VOLUME;
+                for (int c = 0; c < 2; c++) {
+                    int sum = out[done + i + c] + static_cast<int>(mixBuffer[i + c] * level);
+                    out[done + i + c] = static_cast<Sint16>(std::min(32767, std::max(-32768, sum)));
+                }
+            }
+        }
+        gains[d] = gain;
+    }
+
+    for (int d = 0; d < DECKS; d++) {
+        audible[d].store(d == routed || gains[d] > 0.0f, std::memory_order_relaxed);
+    }
+    routingSeen.store(current, std::memory_order_release);
+}
+
+/**
+ * @brief Decoder thread: starts requested tracks on a silent deck and keeps every deck's ring full
+ */
+void MusicPlayer::decodeLoop()
+{
+    int handled = static_cast<int>(MusicTrack::NONE);
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        lock.unlock();
+
+        int wanted = requested.load(std::memory_order_acquire);
+        if (wanted != handled) {
+            MusicTrack track = static_cast<MusicTrack>(wanted);
+            int routed = static_cast<int>(routing.load(std::memory_order_relaxed) & 3) - 1;
+            int next = -1;
+            bool ready = track == MusicTrack::NONE;
+            for (int d = 0; d < DECKS && !ready; d++) {
+                // Already playing, or still fading out and can fade straight back in
+                if (decks[d].file && decks[d].track == track) {
+                    next = d;
+                    ready = true;
+                }
+            }
+            for (int d = 0; d < DECKS && !ready; d++) {
+                if (d != routed && isFree(d)) {
+                    closeTrack(decks[d]);
+                    rings[d]->clear();
+                    if (openTrack(decks[d], track) && fill(d)) {
+                        next = d;
+                    } else {
+                        closeTrack(decks[d]); // Reported; this state stays quiet
+                    }
+                    ready = true;
+                }
+            }
+            // With no silent deck yet, the last crossfade is still running; try again next pass
+            if (ready) {
+                if (next != routed) {
+                    route(next);
+                }
+                handled = wanted;
+            }
+        }
+
+        for (int d = 0; d < DECKS; d++) {
+            if (!decks[d].file) {
+                continue;
+            }
+            if (isFree(d)) {
+                closeTrack(decks[d]);
+            } else if (!fill(d)) {
+                closeTrack(decks[d]);
+            }
+        }
+
+        lock.lock();
+        wake.wait_for(lock, std::chrono::milliseconds(REFILL_MS), [this, handled] {
+            return stopping || requested.load(std::memory_order_relaxed) != handled;
+        });
+    }
+}
+
+/**
+ * @brief Sends playback to a deck, or to silence; decoder thread only
+ * @param deck Deck to fade in, -1 for none
+ */
+void MusicPlayer::route(int deck)
+{
+    uint32_t changes = (routing.load(std::memory_order_relaxed) >> 2) + 1;
+    routing.store(changes << 2 | static_cast<uint32_t>(deck + 1), std::memory_order_release);
+}
+
+/**
+ * @brief Whether the audio thread has faded a deck out and will not read it again until it is routed
+ * @details Only trusted once a callback has mixed with the latest routing. Decoder thread only.
+ */
+bool MusicPlayer::isFree(int deck) const
+{
+    uint32_t current = routing.load(std::memory_order_relaxed);
+    if (static_cast<int>(current & 3) - 1 == deck || routingSeen.load(std::memory_order_acquire) != current) {
+        return false;
+    }
+    return !audible[deck].load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Opens a track's file and checks it can be streamed as is; decoder thread only
+ * @return bool false if the file is missing or in another format (reported)
+ */
+bool MusicPlayer::openTrack(Deck& deck, MusicTrack track)
+{
+    const std::string& path = trackPath(track);
+    SDL_RWops* file = SDL_RWFromFile(path.c_str(), "rb");
+    if (!file) {
+        std::cerr << "MusicPlayer: Could not open " << path << ": " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    WavFormat format;
+    if (!readWavHeader(file, format)) {
+        std::cerr << "MusicPlayer: " << path << " is not a WAV file" << std::endl;
+        SDL_RWclose(file);
+        return false;
+    }
+    if (format.encoding != 1 || format.bits != 16 || format.rate != static_cast<Uint32>(frequency) ||
+        format.channels < 1 || format.channels > 2 || format.dataLength < 2 * format.channels) {
+        std::cerr << "MusicPlayer: " << path << " must be 16-bit PCM at " << frequency << " Hz, mono or stereo" << std::endl;
+        SDL_RWclose(file);
+        return false;
+    }
+
+    deck.track = track;
+    deck.file = file;
+    deck.channels = format.channels;
+    deck.dataStart = format.dataStart;
+    deck.dataLength = format.dataLength;
+    deck.dataRead = 0;
+    return true;
+}
+
+void MusicPlayer::closeTrack(Deck& deck)
+{
+    if (deck.file) {
+        SDL_RWclose(deck.file);
+    }
+    deck = Deck();
+}
+
+/**
+ * @brief Reads blocks into a deck's ring until it is nearly full, looping at the end of the data
+ * @return bool false on a read error (reported)
+ */
+bool MusicPlayer::fill(int deck)
+{
+    Deck& source = decks[deck];
+    SampleRing& ring = *rings[deck];
+    const size_t frameBytes = sizeof(Sint16) * source.channels;
+    const size_t blockBytes = sizeof(Sint16) * READ_SAMPLES / (3 - source.channels); // Mono doubles up below
+
+    while (ring.getFree() >= static_cast<size_t>(READ_SAMPLES)) {
+        if (source.dataRead + frameBytes > source.dataLength) {
+            // Gapless loop
+            SDL_RWseek(source.file, source.dataStart, RW_SEEK_SET);
+            source.dataRead = 0;
+        }
+        size_t bytes = std::min<size_t>(blockBytes, source.dataLength - source.dataRead);
+        size_t got = SDL_RWread(source.file, readBuffer, 1, bytes - bytes % frameBytes);
+        got -= got % frameBytes;
+        if (got == 0) {
+            if (source.dataRead > 0) {
+                source.dataLength = source.dataRead; // Data chunk claimed more than the file holds
+                continue;
+            }
+            std::cerr << "MusicPlayer: Could not read " << trackPath(source.track) << std::endl;
+            return false;
+        }
+        source.dataRead += static_cast<Uint32>(got);
+
+        size_t samples = got / sizeof(Sint16);
+        for (size_t i = 0; i < samples; i++) {
+            readBuffer[i] = static_cast<Sint16>(SDL_SwapLE16(static_cast<Uint16>(readBuffer[i])));
+        }
+        if (source.channels == 1) {
+            for (size_t i = samples; i-- > 0;) {
+                Sint16 sample = readBuffer[i];
+                readBuffer[2 * i] = sample;
+                readBuffer[2 * i + 1] = sample;
+            }
+            samples *= 2;
+        }
+        ring.pushSome(readBuffer, samples);
+    }
+    return true;
+}
@@ -0,0 +1,111 @@
+#include <algorithm> // For the capacity clamp
+#include <cmath> // For launch directions
+
+#include "particle_system.hpp" // Class header
+
+/**
+ * @brief Sizes every buffer for the most particles the view will show at once
+ * @param capacity Most live particles; emits past it are cut short
+ */
+ParticleSystem::ParticleSystem(int capacity) :
+    capacity(std::max(0, capacity))
+{
+    for (std::vector<float>* buffer : {&posX, &posY, &velX, &velY, &gravity, &drag, &alpha, &fade, &halfSize}) {
+        buffer->assign(this->capacity, 0.0f);
+    }
+    color.assign(this->capacity, SDL_Color{0, 0, 0, 0});
+}
+
+/**
+ * @brief Adds a burst of particles
+ * @param emitter Burst settings
+ * @param position Where the burst starts, world space
+ * @param scale Multiplies speeds, sizes and gravity, e.g. the metrics' height scale
+ * @return int particles actually added
+ */
+int ParticleSystem::emit(const ParticleEmitter& emitter, const Vector2D& position, float scale)
+{
+    int added = std::min(emitter.count, capacity - live);
+    for (int n = 0; n < added; n++) {
+        int i = live + n;
+        float angle = emitter.angle + random(-emitter.spread, emitter.spread);
+        float speed = random(emitter.minSpeed, emitter.maxSpeed) * scale;
+        posX[i] = position.x;
+        posY[i] = position.y;
+        velX[i] = std::cos(angle) * speed;
+        velY[i] = std::sin(angle) * speed;
+        gravity[i] = emitter.gravity * scale;
+        drag[i] = emitter.drag;
+        alpha[i] = emitter.color.a;
+        fade[i] = emitter.color.a / std::max(1.0f, random(emitter.minLife, emitter.maxLife));
+        halfSize[i] = random(emitter.minSize, emitter.maxSize) * scale * 0.5f;
+        color[i] = emitter.color;
+    }
+    live += added;
+    return added;
+}
+
+/**
+ * @brief Advances every particle one tick and drops the ones that faded out
+ */
+void ParticleSystem::step()
+{
+    float* __restrict x = posX.data();
+    float* __restrict y = posY.data();
+    float* __restrict vx = velX.data();
+    float* __restrict vy = velY.data();
+    float* __restrict a = alpha.data();
+    const float* __restrict g = gravity.data();
+    const float* __restrict d = drag.data();
+    const float* __restrict f = fade.data();
+    for (int i = 0; i < live; i++) {
+        vx[i] *= d[i];
+        vy[i] = vy[i] * d[i] + g[i];
+        x[i] += vx[i];
+        y[i] += vy[i];
+        a[i] -= f[i];
+    }
+
+    // Pack the survivors down, keeping their order
+    int kept = 0;
+    for (int i = 0; i < live; i++) {
+        if (a[i] <= 0.0f) {
+            continue;
+        }
+        if (kept != i) {
+            x[kept] = x[i];
+            y[kept] = y[i];
+            vx[kept] = vx[i];
+            vy[kept] = vy[i];
+            a[kept] = a[i];
+            gravity[kept] = g[i];
+            drag[kept] = d[i];
+            fade[kept] = f[i];
+            halfSize[kept] = halfSize[i];
+            color[kept] = color[i];
+        }
+        color[kept].a = static_cast<Uint8>(a[kept]);
+        kept++;
+    }
+    live = kept;
+}
+
+/**
+ * @brief Records every live particle as a square, in one batch
+ */
+void ParticleSystem::draw(RenderCommandBuffer& commands) const
+{
+    commands.squares(posX.data(), posY.data(), halfSize.data(), color.data(), live);
+}
+
+/**
+ * @brief Xorshift random float; cheap, allocation-free and the same on every platform
+ * @return float in [low, high)
+ */
+float ParticleSystem::random(float low, float high)
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return low + (high - low) * ((randomState >> 8) * (1.0f / 16777216.0f));
+}
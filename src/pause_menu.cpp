@@ -26,7 +26,7 @@ PauseMenu::PauseMenu(SDL_Renderer* renderer, TTF_Font* font, TTF_Font* hoverFont
     quitButton.updateScreenPosition();
 }
 
-void PauseMenu::render() {
+void PauseMenu::render(RenderCommandBuffer& commands) {
     // Check if valid
     if (!renderer) {
         std::cerr << "PauseMenu::render - Renderer is null!" << std::endl;
@@ -38,10 +38,8 @@ void PauseMenu::render() {
     }
     
     // Draw semi-transparent overlay
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
     SDL_Rect fullScreen = {0, 0, screenWidth, screenHeight};
-    SDL_RenderFillRect(renderer, &fullScreen);
+    commands.fillRect(fullScreen, {0, 0, 0, 180});
     
     // Draw pause menu title
     float titleWidthPercent = 0.24f;
@@ -57,9 +55,9 @@ void PauseMenu::render() {
     SDL_Color textColor = {70, 35, 0, 255}; // Color for text
 
     // Render title and buttons
-    titleBox.renderBox(renderer, textColor);
-    resumeButton.renderBox(renderer, textColor);
-    quitButton.renderBox(renderer, textColor);
+    titleBox.renderBox(commands, textColor);
+    resumeButton.renderBox(commands, textColor);
+    quitButton.renderBox(commands, textColor);
 }
 
 bool PauseMenu::handleEvent(SDL_Event& e) {
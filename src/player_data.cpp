@@ -7,6 +7,36 @@ PlayerData::PlayerData() {
     // Default initialization is in the header
 }
 
+/**
+ * @brief Pays out a finished fishing day: ledger income, catch earnings and rent
+ * @param catchScore Points scored during the round
+ * @return DaySettlement breakdown of the day's earnings
+ * @details Cash may go negative here; the caller decides whether that is a game over
+ */
+DaySettlement PlayerData::settleDay(int catchScore) {
+    applyLedgerIncome();
+    addFishCaught(catchScore);
+
+    // Calculate earnings with cash register multiplier
+    DaySettlement result;
+    result.catchScore = catchScore;
+    result.multiplier = getCashMultiplier();
+    int baseValue = catchScore * Game::BASE_SCORE_MULTIPLIER;
+    result.gross = static_cast<int>(baseValue * result.multiplier);
+    result.rentPaid = rent;
+    result.profit = result.gross - rent;
+    addCash(result.profit);
+    return result;
+}
+
+/**
+ * @brief Moves on to the next day and raises the rent
+ */
+void PlayerData::advanceDay() {
+    setRent(rent * Game::RENT_INCREASE);
+    incrementDay();
+}
+
 bool PlayerData::saveGame(const std::string& filename) const {
     try {
         std::ofstream saveFile(filename);
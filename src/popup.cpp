@@ -25,48 +25,28 @@ void Popup::show(const std::string& title, const std::vector<std::string>& lines
     visible = true;
 }
 
-void Popup::render() {
+void Popup::render(RenderCommandBuffer& commands) {
     if (!visible) return;
     
     // Semi-transparent dark overlay behind popup
-    SDL_SetRenderDrawColor(renderer, Colors::Black::R, Colors::Black::G, Colors::Black::B, Colors::Black::ATrans);
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
     SDL_Rect fullScreen = {0, 0, screenWidth, screenHeight};
-    SDL_RenderFillRect(renderer, &fullScreen);
+    commands.fillRect(fullScreen, {Colors::Black::R, Colors::Black::G, Colors::Black::B, Colors::Black::ATrans});
     
-    SDL_SetRenderDrawColor(renderer, Colors::Tan::R, Colors::Tan::G, Colors::Tan::B, Colors::Tan::A); // Background
-    SDL_RenderFillRect(renderer, &popupRect);
-    SDL_SetRenderDrawColor(renderer, Colors::Brown::R, Colors::Brown::G, Colors::Brown::B, Colors::Brown::A); // Outer border
-    SDL_RenderDrawRect(renderer, &popupRect);
+    commands.fillRect(popupRect, {Colors::Tan::R, Colors::Tan::G, Colors::Tan::B, Colors::Tan::A}); // Background
+    commands.outlineRect(popupRect, {Colors::Brown::R, Colors::Brown::G, Colors::Brown::B, Colors::Brown::A}); // Outer border
     SDL_Rect innerRect = {popupRect.x + 2, popupRect.y + 2, popupRect.w - 4, popupRect.h - 4}; // Inner border
-    SDL_SetRenderDrawColor(renderer, Colors::Wheat::R, Colors::Wheat::G, Colors::Wheat::B, Colors::Wheat::A);
-    SDL_RenderDrawRect(renderer, &innerRect);
+    commands.outlineRect(innerRect, {Colors::Wheat::R, Colors::Wheat::G, Colors::Wheat::B, Colors::Wheat::A});
     SDL_Color textColor = {Colors::DarkBrown::R, Colors::DarkBrown::G, Colors::DarkBrown::B, Colors::DarkBrown::A}; // Text color
     
     // Scale font sizes for title and message
     int scaledTitleFontSize = Scale::scaleFontSize(Visuals::POPUP_TITLE_FONT_SIZE);
     int scaledTextFontSize = Scale::scaleFontSize(Visuals::POPUP_TEXT_FONT_SIZE);
-    TTF_SetFontSize(font, scaledTitleFontSize);
     
     // Render title centered at top of popup
-    SDL_Surface* titleSurface = TTF_RenderText_Blended(font, title.c_str(), textColor);
-    if (titleSurface) {
-        SDL_Texture* titleTexture = SDL_CreateTextureFromSurface(renderer, titleSurface);
-        if (titleTexture) {
-            SDL_Rect titleRect = {
-                popupRect.x + (popupRect.w - titleSurface->w) / 2,
-                popupRect.y + static_cast<int>(popupRect.h * 0.06f),
-                titleSurface->w,
-                titleSurface->h
-            };
-            SDL_RenderCopy(renderer, titleTexture, NULL, &titleRect);
-            SDL_DestroyTexture(titleTexture);
-        }
-        SDL_FreeSurface(titleSurface);
-    }
+    SDL_Rect titleArea = {popupRect.x, popupRect.y + static_cast<int>(popupRect.h * 0.06f), popupRect.w, 0};
+    commands.text(font, scaledTitleFontSize, title, titleArea, textColor, TextAlign::CENTER_X);
     
-    // Set font size for message lines and render
-    TTF_SetFontSize(font, scaledTextFontSize);
+    // Render message lines
     float contentStartPercent = 0.2f;
     float lineSpacingPercent = 0.08f;
     
@@ -74,21 +54,8 @@ void Popup::render() {
     int lineSpacing = static_cast<int>(popupRect.h * lineSpacingPercent);
     
     for (const auto& line : messageLines) {
-        SDL_Surface* lineSurface = TTF_RenderText_Blended(font, line.c_str(), textColor);
-        if (lineSurface) {
-            SDL_Texture* lineTexture = SDL_CreateTextureFromSurface(renderer, lineSurface);
-            if (lineTexture) {
-                SDL_Rect lineRect = {
-                    popupRect.x + static_cast<int>(popupRect.w * 0.07f),
-                    lineY,
-                    lineSurface->w,
-                    lineSurface->h
-                };
-                SDL_RenderCopy(renderer, lineTexture, NULL, &lineRect);
-                SDL_DestroyTexture(lineTexture);
-            }
-            SDL_FreeSurface(lineSurface);
-        }
+        SDL_Rect lineArea = {popupRect.x + static_cast<int>(popupRect.w * 0.07f), lineY, 0, 0};
+        commands.text(font, scaledTextFontSize, line, lineArea, textColor);
         lineY += lineSpacing;
     }
 }
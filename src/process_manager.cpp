@@ -11,6 +11,7 @@
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm> // For lane frame clamp and layout
 #include <errno.h>      // For errno and strerror
 #include <string.h>     // For strerror
 #include <limits.h>     // For PATH_MAX
@@ -19,9 +20,17 @@
 #include <mach-o/dyld.h> // For _NSGetExecutablePath
 #endif
 
-ProcessManager::ProcessManager() :
+/**
+ * @brief Opens the window and menu
+ * @param useRenderThread Replay and present frames on a dedicated render thread
+ * @param pacing How the main loop waits between frames
+ * @param targetFps Frame rate to pace to, 0 for the display's refresh rate
+ */
+ProcessManager::ProcessManager(bool useRenderThread, PacingMode pacing, int targetFps) :
+    framePacer(pacing, targetFps),
     currentState(GameState::MENU),
     isRunning(true),
+    screenMetrics(WorldMetrics::fromCurrentScreen()), // Resolution changes relaunch the game, so this is fixed
     transitionDone(false),
     fishPopup(false),          // Explicitly initialize to false
     loanPaidPopup(false),      // Initialize loan paid popup flag
@@ -29,7 +38,7 @@ ProcessManager::ProcessManager() :
     pendingState(GameState::MENU)  // Initialize with a default value
 {
     std::cout << "ProcessManager: Initializing..." << std::endl;
-    initializeSDL();
+    initializeSDL(useRenderThread);
     // Init Menu module
     try {
         menuView = std::make_unique<MenuView>(gameNotifier, window, renderer);
@@ -37,6 +46,7 @@ ProcessManager::ProcessManager() :
     } catch (const std::exception& e) {
         std::cerr << "ERROR: Failed to create MenuView: " << e.what() << std::endl;
     }
+    playStateMusic();
 
     // Notifier handling with error checking
     std::cout << "ProcessManager: Setting up callbacks..." << std::endl;
@@ -63,18 +73,21 @@ ProcessManager::ProcessManager() :
 
     // Init popup stuff
     try {
-        TTF_Font* font = TTF_OpenFont("../resource/Arial.ttf", 16); // These font opens are redundant w/ baseview, but I'm too scared to remove them at this point
-        if (!font) {
-            std::cerr << "WARNING: Failed to load popup font: " << TTF_GetError() << std::endl;
-            // Try fallback fonts
-            font = TTF_OpenFont("C:\\Windows\\Fonts\\arial.ttf", 16);
-            if (!font) {
-                font = TTF_OpenFont("/usr/share/fonts/TTF/DejaVuSans.ttf", 16);
-            }
+        TTF_Font* font = nullptr;
+        RenderThread::runOnRenderer([&font] {
+            font = TTF_OpenFont("../resource/Arial.ttf", 16); // These font opens are redundant w/ baseview, but I'm too scared to remove them at this point
             if (!font) {
-                std::cerr << "ERROR: Failed to load any fonts for popup" << std::endl;
+                std::cerr << "WARNING: Failed to load popup font: " << TTF_GetError() << std::endl;
+                // Try fallback fonts
+                font = TTF_OpenFont("C:\\Windows\\Fonts\\arial.ttf", 16);
+                if (!font) {
+                    font = TTF_OpenFont("/usr/share/fonts/TTF/DejaVuSans.ttf", 16);
+                }
+                if (!font) {
+                    std::cerr << "ERROR: Failed to load any fonts for popup" << std::endl;
+                }
             }
-        }
+        });
         popup = std::make_unique<Popup>(renderer, font, Dimens::SCREEN_W, Dimens::SCREEN_H);
         std::cout << "ProcessManager: Popup created successfully" << std::endl;
     } catch (const std::exception& e) {
@@ -99,17 +112,65 @@ ProcessManager::~ProcessManager() {
     fflush(stdout);
     fflush(stderr);
 
+    if (latencyReport) {
+        telemetry.report(std::cout);
+    }
+    if (allocReport) {
+        AllocTracker::report(std::cout);
+        std::cout << "  Frame arena: peak " << FrameArena::perFrame().getHighWater() << " of "
+                  << FrameArena::perFrame().getCapacity() << " bytes" << std::endl;
+    }
+
+    // Views hold textures and fonts, release them while the renderer is still alive
+    if (frozenScene) {
+        RenderThread::runOnRenderer([this] { SDL_DestroyTexture(frozenScene); });
+        frozenScene = nullptr;
+    }
+    if (sceneTarget) {
+        RenderThread::runOnRenderer([this] { SDL_DestroyTexture(sceneTarget); });
+        sceneTarget = nullptr;
+    }
+    popup.reset();
+    fishingView.reset();
+    storeView.reset();
+    menuView.reset();
+
+    music.close();
+    audio.close();
+    releaseRenderer();
     TTF_Quit();
-    SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
 }
 
+/**
+ * @brief Sets how many ponds are fished at once; every lane after the player's is played by a bot
+ * @param count Total lanes including the player's, 1 for a normal round
+ */
+void ProcessManager::setLaneCount(int count) {
+    laneCount = std::max(1, count);
+    if (laneCount > 1) {
+        std::cout << "ProcessManager: Fishing with " << laneCount - 1 << " rival lanes" << std::endl;
+    }
+}
+
+/**
+ * @brief Hands fishing-round input to a bot instead of the keyboard
+ * @param newBot Bot to use, nullptr to go back to keyboard play
+ */
+void ProcessManager::setBot(std::unique_ptr<Bot> newBot) {
+    bot = std::move(newBot);
+    if (bot) {
+        std::cout << "ProcessManager: Fishing rounds played by bot '" << bot->getName() << "'" << std::endl;
+    }
+}
+
 /**
  * @brief Initializes SDL with acceleration if possible
  * @details Includes self-defeating debugging attempt from a while back, kept in case a similar error shows up again 
+ * @param useRenderThread Create the renderer on a RenderThread instead of this thread
  */
-void ProcessManager::initializeSDL() {
+void ProcessManager::initializeSDL(bool useRenderThread) {
     std::cout << "ProcessManager: Initializing SDL..." << std::endl;
 
     // Initialize SDL with all required subsystems
@@ -148,53 +209,28 @@ void ProcessManager::initializeSDL() {
     }
 
     std::cout << "ProcessManager: Window created successfully" << std::endl;
+    framePacer.detectDisplay(window); // Decides whether the renderer should use vsync
     std::cout << "ProcessManager: Creating renderer..." << std::endl;
 
-    // Try with and without vsync depending on platform
-#ifdef _WIN32
-    // On Windows, try without vsync first
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
-#else
-    // On other platforms, try with vsync first
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-#endif
-
-    // If that failed, try the alternative
-    if (renderer == nullptr) {
-        std::cerr << "First renderer creation attempt failed: " << SDL_GetError() << std::endl;
-
-#ifdef _WIN32
-        // On Windows, fall back to vsync
-        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-#else
-        // On other platforms, fall back to no vsync
-        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
-#endif
-
-        // If still failed, try software renderer as last resort
-        if (renderer == nullptr) {
-            std::cerr << "Second renderer creation attempt failed: " << SDL_GetError() << std::endl;
-            renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+    // The renderer belongs to the thread that creates it
+    try {
+        if (useRenderThread) {
+            renderThread.reset(new RenderThread([this] { return createRenderer(); }));
+            renderer = renderThread->getRenderer();
+        } else {
+            renderer = createRenderer();
         }
-    }
-
-    // If all renderer creation attempts failed, throw error
-    if (renderer == nullptr) {
+    } catch (...) {
         SDL_DestroyWindow(window);
         SDL_Quit();
-        throw std::runtime_error("Renderer could not be created! Error: " + std::string(SDL_GetError()));
+        throw;
     }
 
-    std::cout << "ProcessManager: Renderer created successfully" << std::endl;
-
-    // Set blend mode for transparency support
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
     // Initialize SDL_image for texture loading
     std::cout << "ProcessManager: Initializing SDL_image..." << std::endl;
     int imgFlags = IMG_INIT_PNG;
     if (!(IMG_Init(imgFlags) & imgFlags)) {
-        SDL_DestroyRenderer(renderer);
+        releaseRenderer();
         SDL_DestroyWindow(window);
         SDL_Quit();
         throw std::runtime_error("SDL_image could not initialize! Error: " + std::string(IMG_GetError()));
@@ -206,13 +242,19 @@ void ProcessManager::initializeSDL() {
     // Initialize TTF
     if (TTF_Init() < 0) {
         IMG_Quit();
-        SDL_DestroyRenderer(renderer);
+        releaseRenderer();
         SDL_DestroyWindow(window);
         SDL_Quit();
         throw std::runtime_error("TTF could not initialize! Error: " + std::string(TTF_GetError()));
     }
 
     std::cout << "ProcessManager: SDL_ttf initialized successfully" << std::endl;
+
+    if (!audio.open()) {
+        std::cerr << "ProcessManager: Continuing without sound" << std::endl;
+    } else if (!music.open()) {
+        std::cerr << "ProcessManager: Continuing without music" << std::endl;
+    }
     std::cout << "ProcessManager: SDL initialization complete" << std::endl;
 
     // Clear any non-fatal SDL errors that might have occurred during initialization
@@ -223,6 +265,55 @@ void ProcessManager::initializeSDL() {
     }
 }
 
+/**
+ * @brief Creates the window's renderer, falling back from accelerated/vsync to software
+ * @return SDL_Renderer* new renderer, throws if none could be created
+ */
+SDL_Renderer* ProcessManager::createRenderer() {
+    SDL_Renderer* newRenderer = nullptr;
+
+    // Vsync only when the pacer trusts it to hold the frame rate, so frames never wait twice
+    if (framePacer.wantsVsync()) {
+        newRenderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+        if (newRenderer == nullptr) {
+            std::cerr << "Vsync renderer creation attempt failed: " << SDL_GetError() << std::endl;
+        }
+    }
+    if (newRenderer == nullptr) {
+        newRenderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+
+        // If still failed, try software renderer as last resort
+        if (newRenderer == nullptr) {
+            std::cerr << "Accelerated renderer creation attempt failed: " << SDL_GetError() << std::endl;
+            newRenderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+        }
+    }
+
+    // If all renderer creation attempts failed, throw error
+    if (newRenderer == nullptr) {
+        throw std::runtime_error("Renderer could not be created! Error: " + std::string(SDL_GetError()));
+    }
+
+    std::cout << "ProcessManager: Renderer created successfully" << std::endl;
+    framePacer.rendererCreated(newRenderer);
+
+    // Set blend mode for transparency support
+    SDL_SetRenderDrawBlendMode(newRenderer, SDL_BLENDMODE_BLEND);
+    return newRenderer;
+}
+
+/**
+ * @brief Destroys the renderer, on the render thread when there is one
+ */
+void ProcessManager::releaseRenderer() {
+    if (renderThread) {
+        renderThread.reset();
+    } else if (renderer) {
+        SDL_DestroyRenderer(renderer);
+    }
+    renderer = nullptr;
+}
+
 void ProcessManager::handleStateTransition(GameState newState) {
     std::cout << "ProcessManager::handleStateTransition from " << static_cast<int>(currentState)
               << " to " << static_cast<int>(newState) << std::endl;
@@ -284,6 +375,7 @@ void ProcessManager::handleStateTransition(GameState newState) {
         if (fishingLogic) {
             fishingLogic->setRunning(false);
         }
+        laneScheduler = nullptr;
         fishingView = nullptr;
         fishingLogic = nullptr;
         
@@ -305,17 +397,19 @@ void ProcessManager::handleStateTransition(GameState newState) {
             std::cout << "ProcessManager: Creating new fishing state" << std::endl;
             int level = calculateFishingLevel();
             int roundDuration = Game::ROUND_DURATION + (playerData.getClockLevel() * 10 * 1000);
-            fishingLogic = std::make_shared<FishingLogic>(level, roundDuration, playerData.getRodLevel());
+            fishingLogic = std::make_shared<FishingLogic>(level, roundDuration, playerData.getRodLevel(), WorldMetrics::world());
             
             // Set callback for fishing logic to handle notifications
             fishingLogic->setCallback([this](const std::string& notification) {
                 this->handleNotification(notification);
             });
             
-            fishingView = std::make_unique<FishingView>(fishingLogic, window, renderer, Dimens::SCREEN_H, Dimens::SCREEN_W);
+            fishingView = std::make_unique<FishingView>(fishingLogic, window, renderer, screenMetrics);
             fishingLogic->setRunning(true);
             fishingLogic->spawnNewFloaters();
             fishingLogic->resetRoundStartTime();
+            createRivalLanes(level, roundDuration);
+            startFishingClock();
             transitionDone = false;
             std::cout << "ProcessManager: Fishing state created successfully" << std::endl;
         } else if (newState == GameState::STORE) {
@@ -332,6 +426,7 @@ void ProcessManager::handleStateTransition(GameState newState) {
         }
 
         currentState = newState;
+        playStateMusic();
         std::cout << "ProcessManager: State transition complete. Current state: " << static_cast<int>(currentState) << std::endl;
     } catch (const std::exception& e) {
         std::cerr << "ERROR during state transition: " << e.what() << std::endl;
@@ -341,14 +436,13 @@ void ProcessManager::handleStateTransition(GameState newState) {
         if (newState != GameState::MENU) {
             std::cout << "ProcessManager: Falling back to menu state after transition failure" << std::endl;
             currentState = GameState::MENU;
+            playStateMusic();
         }
     }
 }
 
 void ProcessManager::run() {
     // Main game loop
-    frameStart = SDL_GetTicks();
-
     // Clear any pending events at startup
     SDL_Event e;
     while (SDL_PollEvent(&e)) {
@@ -358,19 +452,24 @@ void ProcessManager::run() {
     std::cout << "Starting main game loop" << std::endl;
 
     while (isRunning) {
+        AllocTracker::beginFrame();
+        FrameArena::perFrame().reset(); // Last frame's transient strings and lists are done with
+
         // Process all events first
         updateCurrentModule();
 
         // Render current frame
         renderCurrentModule();
 
-        // Calculate and apply frame delay
-        frameTime = SDL_GetTicks() - frameStart;
-        if (FRAME_DELAY > frameTime) {
-            SDL_Delay(FRAME_DELAY - frameTime);
-        }
+        AllocTracker::endFrame(); // Before the pacer so its sleep isn't part of the frame
 
-        frameStart = SDL_GetTicks();
+        // Wait out the rest of the frame unless vsync already did
+        framePacer.waitForNextFrame();
+        if (latencyReport) {
+            telemetry.recordFrame(framePacer.getLastFrameMs());
+            audio.collectLatencies(telemetry);
+        }
+        sampleRenderTime();
     }
 }
 
@@ -379,12 +478,7 @@ void ProcessManager::updateCurrentModule() {
     userInput = UserInput::Action::NONE;
     bool quitToMenu = false;
 
-    // Debug output to verify event processing
-    bool eventProcessed = false;
-
     while (SDL_PollEvent(&e) != 0) {
-        eventProcessed = true;
-
         // Debug output to see what events are being processed
         if (e.type == SDL_KEYDOWN || e.type == SDL_MOUSEBUTTONDOWN || e.type == SDL_MOUSEMOTION) {
             //std::cout << "Event processed: Type=" << e.type;
@@ -401,6 +495,11 @@ void ProcessManager::updateCurrentModule() {
             return;
         }
 
+        // Some drivers drop render target contents; capture the frozen scene again
+        if (e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET) {
+            sceneFrozen = false;
+        }
+
         // Handle popup events
         if ((fishPopup || loanPaidPopup) && popup->handleEvent(e)) {
             std::cout << "Popup closed" << std::endl;
@@ -434,6 +533,7 @@ void ProcessManager::updateCurrentModule() {
                 if (transitionWait) {
                     if (currentState == GameState::FISHING) {
                         std::cout << "Cleaning up fishing after popup" << std::endl;
+                        laneScheduler = nullptr;
                         fishingView = nullptr;
                         fishingLogic = nullptr;
                     }
@@ -445,6 +545,7 @@ void ProcessManager::updateCurrentModule() {
                         std::cout << "Transitioning to store" << std::endl;
                         storeView = std::make_unique<StoreView>(gameNotifier, window, renderer, playerData);
                         currentState = newState;
+                        playStateMusic();
                     }
                 }
             } else if (loanPaidPopup) {
@@ -476,19 +577,25 @@ void ProcessManager::updateCurrentModule() {
                 break;
 
             case GameState::FISHING:
+                if ((e.type == SDL_KEYDOWN || e.type == SDL_KEYUP) && !e.key.repeat) {
+                    inputQueue.pushKey(e.key.timestamp, e.key.keysym.scancode, e.type == SDL_KEYDOWN);
+                }
                 if (fishingView) {
                     UserInput::Action event = fishingView->handleKeyboardInput(e);
 
                     if (event == UserInput::Action::QUIT) {
                         quitToMenu = true;
-                    } else if (event != UserInput::Action::NONE && fishingLogic) {
-                        fishingLogic->handleUserInput(event);
+                    } else if (event != UserInput::Action::NONE) {
+                        inputQueue.pushAction(e.common.timestamp, event); // Applied by the tick covering it
                     }
                 }
                 break;
                 
             case GameState::PAUSED_FISHING:
-                // Handle events while paused
+                // Keep held keys current so resuming doesn't leave the hook moving
+                if ((e.type == SDL_KEYDOWN || e.type == SDL_KEYUP) && !e.key.repeat) {
+                    inputQueue.pushKey(e.key.timestamp, e.key.keysym.scancode, e.type == SDL_KEYDOWN);
+                }
                 if (fishingView) {
                     fishingView->handlePauseMenuInput(e);
                 }
@@ -499,28 +606,30 @@ void ProcessManager::updateCurrentModule() {
         }
     }
 
-    if (!eventProcessed) {
-        // If no events were processed, add a small delay to prevent CPU usage when idle
-        SDL_Delay(1);
-    }
-
     if (quitToMenu) {
         handleStateTransition(GameState::MENU);
         return;
     }
 
-    // Update game state for active modules
+    // Update game state for active modules: one fixed tick per FRAME_DELAY of event time
     if (currentState == GameState::FISHING && !fishPopup && !loanPaidPopup && fishingLogic && fishingView) {
-        UserInput::Action continuousInput = fishingView->handleContinuousInput();
-        fishingLogic->handleUserInput(continuousInput);
-
-        fishingLogic->update();
-
-        // Check if game state needs to change
-        if (!transitionDone && (!fishingLogic->getRunning() || fishingLogic->getElapsedTime() >= fishingLogic->getRoundDuration())) {
-            showFishPopup();
-            return;
+        Uint32 now = SDL_GetTicks();
+        Uint32 maxBacklog = MAX_CATCHUP_TICKS * FRAME_DELAY;
+        if (SDL_TICKS_PASSED(now, nextTickTime + maxBacklog)) {
+            nextTickTime = now - maxBacklog; // Drop time after a stall instead of spiralling
+        }
+        while (SDL_TICKS_PASSED(now, nextTickTime) && currentState == GameState::FISHING) {
+            runFishingTick(nextTickTime);
+            nextTickTime += FRAME_DELAY;
+
+            // Check if game state needs to change
+            if (!transitionDone && (!fishingLogic->getRunning() || fishingLogic->getElapsedTime() >= fishingLogic->getRoundDuration())) {
+                showFishPopup();
+                return;
+            }
         }
+    } else {
+        nextTickTime = SDL_GetTicks(); // Paused or behind a popup; resume without catching up
     }
     // Check for any pending state transitions
     if (transitionWait && !fishPopup && !loanPaidPopup) {
@@ -530,54 +639,295 @@ void ProcessManager::updateCurrentModule() {
     }
 }
 
-void ProcessManager::renderCurrentModule() {
-    // Set default background color in case rendering fails
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderClear(renderer);
+/**
+ * @brief Applies queued input up to a tick's time, then advances the round (and rival lanes) one tick
+ * @param tickTime Event time the tick covers up to
+ */
+void ProcessManager::runFishingTick(Uint32 tickTime) {
+    tickActions.clear();
+    Uint32 oldestInput = inputQueue.drain(tickTime, tickActions);
+    if (oldestInput && !unrenderedInputTime) {
+        unrenderedInputTime = oldestInput;
+    }
+    for (UserInput::Action action : tickActions) {
+        fishingLogic->handleUserInput(action);
+    }
 
-    bool renderSuccessful = false;
+    UserInput::Action continuousInput;
+    if (bot) {
+        fishingLogic->observe(botObservation);
+        continuousInput = bot->nextAction(botObservation);
+    } else {
+        continuousInput = inputQueue.heldDirection();
+    }
+    if (laneScheduler) {
+        // Player lane gets its input here; rival lanes ask their bots on the workers
+        laneScheduler->setInput(0, continuousInput);
+        laneScheduler->tick(FRAME_DELAY);
+    } else {
+        fishingLogic->handleUserInput(continuousInput);
+        fishingLogic->update();
+    }
+    playFishingEvents();
+}
 
-    try {
-        // Call module's render method
-        //std::cout << "Rendering state " << static_cast<int>(currentState) << std::endl;
+/**
+ * @brief Triggers a sound for each fishing event the last tick pushed
+ */
+void ProcessManager::playFishingEvents() {
+    const FishingEventQueue& events = fishingLogic->getEvents();
+    for (uint32_t i = std::max(playedEvents, events.getOldest()); i < events.getCount(); i++) {
+        audio.triggerEvent(events.get(i).type);
+    }
+    playedEvents = events.getCount();
+}
 
-        switch (currentState) {
-            case GameState::MENU:
-                if (menuView) {
-                    menuView->render();
-                    renderSuccessful = true;
-                } else {
-                    std::cerr << "ERROR: menuView is null during render!" << std::endl;
-                }
-                break;
+/**
+ * @brief Crossfades to the current state's track; returns at once, the music player streams it in
+ */
+void ProcessManager::playStateMusic() {
+    switch (currentState) {
+        case GameState::MENU:
+            music.play(MusicTrack::MENU);
+            break;
+        case GameState::STORE:
+        case GameState::PAUSED_STORE:
+            music.play(MusicTrack::STORE);
+            break;
+        case GameState::FISHING:
+        case GameState::PAUSED_FISHING:
+            music.play(MusicTrack::FISHING);
+            break;
+        default:
+            music.play(MusicTrack::NONE);
+            break;
+    }
+}
 
-            case GameState::STORE:
-                if (storeView) {
-                    storeView->render();
-                    renderSuccessful = true;
-                } else {
-                    std::cerr << "ERROR: storeView is null during render!" << std::endl;
-                }
-                break;
+/**
+ * @brief Restarts the tick clock and input queue for a new round
+ */
+void ProcessManager::startFishingClock() {
+    AllocTracker::resetStats(); // Report the latest round, not menus and loading
+    inputQueue.resync(SDL_GetKeyboardState(nullptr));
+    nextTickTime = SDL_GetTicks();
+    unrenderedInputTime = 0;
+    playedEvents = 0;
+}
 
-            case GameState::FISHING:
-            case GameState::PAUSED_FISHING:  // Handle paused state the same way for rendering
-                if (fishingView) {
-                    fishingView->drawView();
-                    renderSuccessful = true;
-                } else {
-                    std::cerr << "ERROR: fishingView is null during render!" << std::endl;
-                }
-                break;
+/**
+ * @brief Turns on frame time and input-to-photon sampling, printed when the game exits
+ * @param enabled Whether to collect and print
+ */
+void ProcessManager::setLatencyReport(bool enabled) {
+    latencyReport = enabled;
+    if (renderThread) {
+        // Presents happen on the render thread, so latency is sampled there
+        renderThread->setPresentListener(enabled ? [this](const RenderCommandBuffer& frame) { framePresented(frame); }
+                                                 : std::function<void(const RenderCommandBuffer&)>());
+    }
+}
 
-            default:
-                std::cerr << "ERROR: Unknown state during render: " << static_cast<int>(currentState) << std::endl;
-                break;
+/**
+ * @brief Turns on heap allocation counting; totals per frame and per zone are printed on exit
+ * @param enabled Whether to count and print
+ */
+void ProcessManager::setAllocReport(bool enabled) {
+    allocReport = enabled;
+    AllocTracker::setEnabled(enabled);
+}
+
+/**
+ * @brief Sets how far the fishing scene's resolution may drop to hold the frame rate
+ * @param minScale Smallest share of the window's resolution
+ * @param maxScale Largest share, 1 for the window's own; equal bounds fix the scale
+ */
+void ProcessManager::setRenderScaleBounds(float minScale, float maxScale) {
+    renderScaler.setBounds(minScale, maxScale);
+    std::cout << "ProcessManager: Fishing render scale " << renderScaler.getScale() << " (bounds "
+              << minScale << " to " << maxScale << ")" << std::endl;
+}
+
+/**
+ * @brief Feeds the latest replay time of a fishing frame to the resolution scaler, once per replayed frame
+ */
+void ProcessManager::sampleRenderTime() {
+    uint32_t frames = renderThread ? renderThread->getReplayedFrames() : replayedFrames;
+    if (frames == sampledFrames) {
+        return;
+    }
+    sampledFrames = frames;
+    if (currentState != GameState::FISHING) {
+        return; // Only the running round is scaled
+    }
+
+    double replayMs = renderThread ? renderThread->getLastReplayMs() : lastReplayMs;
+    int fps = framePacer.getTargetFps();
+    renderScaler.setBudget(1000.0 / (fps > 0 ? fps : framePacer.getRefreshRate()) * Visuals::RENDER_BUDGET_SHARE);
+    if (renderScaler.addSample(replayMs)) {
+        std::cout << "ProcessManager: Fishing render scale " << renderScaler.getScale() << " after "
+                  << replayMs << " ms replays" << std::endl;
+    }
+    if (latencyReport) {
+        telemetry.recordRenderScale(replayMs, renderScaler.getScale());
+    }
+}
+
+/**
+ * @brief Samples input latency once a frame is presented; may run on the render thread
+ * @param frame Frame that was just presented
+ */
+void ProcessManager::framePresented(const RenderCommandBuffer& frame) {
+    if (latencyReport && frame.getInputTimestamp()) {
+        telemetry.recordInputLatency(SDL_GetTicks() - frame.getInputTimestamp());
+    }
+}
+
+/**
+ * @brief Records the current module's scene, without pause menu or popup
+ * @param commands Frame being recorded
+ * @param scaled Draw the fishing world at the resolution scaler's scale
+ * @return bool false if the module has no view to draw
+ */
+bool ProcessManager::drawScene(RenderCommandBuffer& commands, bool scaled) {
+    switch (currentState) {
+        case GameState::MENU:
+            if (menuView) {
+                menuView->render(commands);
+                return true;
+            }
+            std::cerr << "ERROR: menuView is null during render!" << std::endl;
+            return false;
+
+        case GameState::STORE:
+            if (storeView) {
+                storeView->render(commands);
+                return true;
+            }
+            std::cerr << "ERROR: storeView is null during render!" << std::endl;
+            return false;
+
+        case GameState::FISHING:
+        case GameState::PAUSED_FISHING:  // Handle paused state the same way for rendering
+            if (fishingView) {
+                fishingView->drawView(commands, scaled ? scaledSceneTarget() : nullptr, renderScaler.getScale());
+                drawRivalLanes(commands);
+                return true;
+            }
+            std::cerr << "ERROR: fishingView is null during render!" << std::endl;
+            return false;
+
+        default:
+            std::cerr << "ERROR: Unknown state during render: " << static_cast<int>(currentState) << std::endl;
+            return false;
+    }
+}
+
+/**
+ * @brief Creates a window-sized render target for the scene
+ * @return SDL_Texture* nullptr if the renderer has no render targets
+ */
+SDL_Texture* ProcessManager::createSceneTexture() {
+    int width = static_cast<int>(screenMetrics.screenW);
+    int height = static_cast<int>(screenMetrics.screenH);
+    SDL_Texture* texture = nullptr;
+    RenderThread::runOnRenderer([this, width, height, &texture] {
+        if (SDL_RenderTargetSupported(renderer)) {
+            texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        }
+        if (texture) {
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE); // Opaque copy, no blending
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+            SDL_SetTextureScaleMode(texture, SDL_ScaleModeLinear); // Smooth upscaling from a scaled scene
+#endif
+        }
+    });
+    return texture;
+}
+
+/**
+ * @brief Target for a scaled fishing scene, created on first use
+ * @return SDL_Texture* nullptr while the scale is full (the scene is drawn straight to the window)
+ * or if render targets are unavailable
+ */
+SDL_Texture* ProcessManager::scaledSceneTarget() {
+    if (renderScaler.getScale() >= 1.0f || scalingUnsupported) {
+        return nullptr;
+    }
+    if (!sceneTarget) {
+        sceneTarget = createSceneTexture();
+        if (!sceneTarget) {
+            std::cerr << "ProcessManager: No render target for dynamic resolution, drawing at full size: " << SDL_GetError() << std::endl;
+            scalingUnsupported = true;
+        }
+    }
+    return sceneTarget;
+}
+
+/**
+ * @brief Captures the scene into the freeze-frame texture, once per pause or popup
+ * @details The capture is recorded into this frame ahead of the commands that draw the texture,
+ * so it is replayed (here or on the render thread) before its first use.
+ * @param commands Frame being recorded
+ * @return bool false if render targets are unavailable; the scene is then drawn every frame
+ */
+bool ProcessManager::freezeScene(RenderCommandBuffer& commands) {
+    if (sceneFrozen && frozenState == currentState) {
+        return true;
+    }
+    if (!frozenScene && !freezeUnsupported) {
+        frozenScene = createSceneTexture();
+        if (!frozenScene) {
+            std::cerr << "ProcessManager: No render target for freeze frames, redrawing paused scenes: " << SDL_GetError() << std::endl;
+            freezeUnsupported = true;
+        }
+    }
+    if (!frozenScene) {
+        return false;
+    }
+
+    commands.setTarget(frozenScene);
+    bool drawn = drawScene(commands);
+    commands.setTarget(nullptr);
+    sceneFrozen = drawn;
+    frozenState = currentState;
+    return drawn;
+}
+
+/**
+ * @brief Records the current module's frame, then replays it here or hands it to the render thread
+ */
+void ProcessManager::renderCurrentModule() {
+    RenderCommandBuffer& commands = renderThread ? renderThread->beginFrame() : frameCommands;
+    if (!renderThread) {
+        commands.reset();
+    }
+    commands.setInputTimestamp(unrenderedInputTime);
+    unrenderedInputTime = 0;
+
+    // Set default background color in case rendering fails
+    commands.clear({0, 0, 0, 255});
+
+    bool renderSuccessful = false;
+
+    try {
+        // Under the pause menu or a popup the scene holds still, so it is drawn once and reused
+        bool paused = currentState == GameState::PAUSED_FISHING && fishingView;
+        bool popupShown = (fishPopup || loanPaidPopup) && popup;
+        if ((paused || popupShown) && freezeScene(commands)) {
+            commands.sprite(frozenScene, {0, 0, static_cast<int>(screenMetrics.screenW), static_cast<int>(screenMetrics.screenH)});
+            renderSuccessful = true;
+        } else {
+            sceneFrozen = false;
+            renderSuccessful = drawScene(commands, true);
         }
 
-        // Render popup on top of background
-        if ((fishPopup || loanPaidPopup) && popup) {
-            popup->render();
+        // Overlays on top of the scene
+        if (paused) {
+            fishingView->drawPauseMenu(commands);
+        }
+        if (popupShown) {
+            popup->render(commands);
         }
 
     } catch (const std::exception& e) {
@@ -586,8 +936,8 @@ void ProcessManager::renderCurrentModule() {
 
         // If rendering fails completely, draw a simple fallback screen
         if (!renderSuccessful) {
-            SDL_SetRenderDrawColor(renderer, 0, 0, 100, 255);
-            SDL_RenderClear(renderer);
+            commands.reset();
+            commands.clear({0, 0, 100, 255});
 
             // We would render some error text here, but we can't rely on text rendering if it's failing
             SDL_Rect errorBox = {
@@ -596,14 +946,20 @@ void ProcessManager::renderCurrentModule() {
                 static_cast<int>(Dimens::SCREEN_W/2),
                 static_cast<int>(Dimens::SCREEN_H/2)
             };
-            SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-            SDL_RenderFillRect(renderer, &errorBox);
+            commands.fillRect(errorBox, {255, 0, 0, 255});
         }
     }
 
     // Always attempt to present the renderer
+    if (renderThread) {
+        renderThread->submitFrame(); // Replayed and presented off this thread
+        return;
+    }
     try {
+        lastReplayMs = commands.replayTimed(renderer);
+        replayedFrames++;
         SDL_RenderPresent(renderer);
+        framePresented(commands);
     } catch (const std::exception& e) {
         std::cerr << "CRITICAL ERROR: Failed to present renderer: " << e.what() << std::endl;
         std::cerr << "SDL Error: " << SDL_GetError() << std::endl;
@@ -691,16 +1047,11 @@ void ProcessManager::handleNotification(const std::string& notification) {
 
 void ProcessManager::showFishPopup() {
     if (fishingLogic) {
-        playerData.applyLedgerIncome();
         int catchScore = fishingLogic->getCatchScore();
-        playerData.addFishCaught(catchScore);
-        
-        // Calculate earnings with cash register multiplier
-        float multiplier = playerData.getCashMultiplier();
-        int baseValue = catchScore * Game::BASE_SCORE_MULTIPLIER;
-        int gross = static_cast<int>(baseValue * multiplier);
-        int profit = gross - playerData.getRent();
-        playerData.addCash(profit);
+        DaySettlement day = playerData.settleDay(catchScore);
+        float multiplier = day.multiplier;
+        int gross = day.gross;
+        int profit = day.profit;
 
         if (playerData.getCash() < 0) {
             if (playerData.isLoanPaid()) {
@@ -719,7 +1070,7 @@ void ProcessManager::showFishPopup() {
                       (multiplier > 1.0f ? 
                        " (x" + (std::ostringstream() << std::setprecision(2) << std::defaultfloat << multiplier).str() + " multiplier)" : 
                        ""));
-        lines.push_back("Rent Paid: $" + std::to_string(playerData.getRent()));
+        lines.push_back("Rent Paid: $" + std::to_string(day.rentPaid));
         lines.push_back("Profit: $" + std::to_string(profit));
         if (playerData.getLedgerIncome() > 0) {
             lines.push_back("Ledger Income: $" + std::to_string(playerData.getLedgerIncome()));
@@ -730,8 +1081,7 @@ void ProcessManager::showFishPopup() {
         popup->show("Fishing Results, Day " + std::to_string(playerData.getDayCount()), lines);
         fishPopup = true;
 
-        playerData.setRent(playerData.getRent() * Game::RENT_INCREASE);
-        playerData.incrementDay();
+        playerData.advanceDay();
 
         fishingLogic->setRunning(false);
 
@@ -777,6 +1127,7 @@ bool ProcessManager::createFishingPhaseWithNoHazards() {
         if (fishingLogic) {
             fishingLogic->setRunning(false);
         }
+        laneScheduler = nullptr;
         fishingView = nullptr;
         fishingLogic = nullptr;
         
@@ -792,20 +1143,23 @@ bool ProcessManager::createFishingPhaseWithNoHazards() {
         // Init victory fishing phase
         int level = calculateFishingLevel();
         int roundDuration = Game::ROUND_DURATION + (playerData.getClockLevel() * 10 * 1000);
-        fishingLogic = std::make_shared<FishingLogic>(level, roundDuration, playerData.getRodLevel());
+        fishingLogic = std::make_shared<FishingLogic>(level, roundDuration, playerData.getRodLevel(), WorldMetrics::world());
         fishingLogic->setCallback([this](const std::string& notification) {
             this->handleNotification(notification);
         });
         
         // Create the fishing view
-        fishingView = std::make_unique<FishingView>(fishingLogic, window, renderer, Dimens::SCREEN_H, Dimens::SCREEN_W);
+        fishingView = std::make_unique<FishingView>(fishingLogic, window, renderer, screenMetrics);
         
         // Set up the fishing phase
         fishingLogic->setRunning(true);
         fishingLogic->spawnNewFloaters();
         fishingLogic->resetRoundStartTime();
+        createRivalLanes(level, roundDuration);
+        startFishingClock();
         transitionDone = false;
         currentState = GameState::FISHING;
+        playStateMusic();
         
         return true;
     } catch (const std::exception& e) {
@@ -815,6 +1169,55 @@ bool ProcessManager::createFishingPhaseWithNoHazards() {
     }
 }
 
+/**
+ * @brief Starts bot-played rival rounds on the same level next to the player's round
+ * @param level Day the player's round was created for
+ * @param roundDuration Player's round length, so all lanes end together
+ */
+void ProcessManager::createRivalLanes(int level, int roundDuration) {
+    laneScheduler = nullptr;
+    if (laneCount <= 1 || !fishingLogic) {
+        return;
+    }
+
+    laneScheduler = std::make_unique<LaneScheduler>();
+    laneScheduler->addLane(fishingLogic); // Input set each frame from the keyboard or player bot
+    LevelParams params = LevelTable::global().getLevel(level);
+    for (int i = 1; i < laneCount; i++) {
+        // Headless rivals stay quiet and run on the clock handed to tick()
+        std::shared_ptr<FishingLogic> rival = std::make_shared<FishingLogic>(
+            params, roundDuration, playerData.getRodLevel(), WorldMetrics::world(), false, true);
+        rival->seedRandom(SDL_GetTicks() + i);
+        rival->setRunning(true);
+        rival->spawnNewFloaters();
+        rival->resetRoundStartTime();
+        laneScheduler->addLane(rival, Bot::create("greedy"));
+    }
+}
+
+/**
+ * @brief Draws rival lanes as thumbnails down the right edge of the window
+ * @param commands Frame being recorded
+ */
+void ProcessManager::drawRivalLanes(RenderCommandBuffer& commands) {
+    if (!laneScheduler || !fishingLogic || fishingLogic->isPaused()) {
+        return;
+    }
+
+    int rivals = static_cast<int>(laneScheduler->getLaneCount()) - 1;
+    int rows = std::min(rivals, 4);
+    int columns = (rivals + rows - 1) / rows;
+    int thumbH = static_cast<int>(screenMetrics.screenH / 4);
+    int thumbW = static_cast<int>(screenMetrics.screenW / 4);
+    for (int i = 0; i < rivals; i++) {
+        int column = i / rows;
+        int row = i % rows;
+        SDL_Rect viewport = {static_cast<int>(screenMetrics.screenW) - (columns - column) * thumbW,
+                             row * thumbH, thumbW, thumbH};
+        fishingView->drawLane(commands, laneScheduler->getSnapshot(i + 1), viewport);
+    }
+}
+
 void ProcessManager::logSDLError(const std::string& message) {
     std::cerr << "SDL ERROR: " << message << ": " << SDL_GetError() << std::endl;
 
@@ -1186,7 +1589,7 @@ void ProcessManager::changeResolution(int width, int height) {
             // Clean up SDL
             TTF_Quit();
             IMG_Quit();
-            SDL_DestroyRenderer(renderer);
+            releaseRenderer();
             SDL_DestroyWindow(window);
             SDL_Quit();
             
@@ -0,0 +1,503 @@
+#include <cmath> // For rounding transformed edges
+#include <algorithm> // For line width and strip end clamps
+#include <iostream> // For replay errors
+#include <cstring> // For texture row copies
+#include <SDL2_gfxPrimitives.h> // For ellipse and thick line replay
+
+#include "render_commands.hpp" // Class header
+
+/**
+ * @brief Reserves room for a typical frame up front
+ */
+RenderCommandBuffer::RenderCommandBuffer()
+{
+    commands.reserve(INITIAL_COMMANDS);
+    textStorage.reserve(INITIAL_TEXT);
+    pixelStorage.reserve(INITIAL_PIXELS);
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    vertexStorage.reserve(INITIAL_VERTICES);
+    indexStorage.reserve(INITIAL_INDICES);
+#endif
+}
+
+/**
+ * @brief Empties the buffer for a new frame, keeping its memory, and drops any transform and tag
+ */
+void RenderCommandBuffer::reset()
+{
+    commands.clear();
+    textStorage.clear();
+    pixelStorage.clear();
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    vertexStorage.clear();
+    indexStorage.clear();
+#endif
+    inputTimestamp = 0;
+    resetTransform();
+}
+
+/**
+ * @brief Scales then offsets every position and size recorded from now on
+ * @param newScaleX Horizontal scale, e.g. window width / world width
+ * @param newScaleY Vertical scale
+ * @param newOffsetX Window pixels added after scaling
+ * @param newOffsetY Window pixels added after scaling
+ */
+void RenderCommandBuffer::setTransform(float newScaleX, float newScaleY, int newOffsetX, int newOffsetY)
+{
+    scaleX = newScaleX;
+    scaleY = newScaleY;
+    offsetX = newOffsetX;
+    offsetY = newOffsetY;
+}
+
+int RenderCommandBuffer::transformX(int x) const
+{
+    return static_cast<int>(std::lround(x * scaleX)) + offsetX;
+}
+
+int RenderCommandBuffer::transformY(int y) const
+{
+    return static_cast<int>(std::lround(y * scaleY)) + offsetY;
+}
+
+/**
+ * @brief Applies the transform to a rect; edges are rounded separately so neighbours stay seamless
+ * @param rect Rect in recording units
+ * @return SDL_Rect rect in window pixels
+ */
+SDL_Rect RenderCommandBuffer::transform(const SDL_Rect& rect) const
+{
+    int left = transformX(rect.x);
+    int top = transformY(rect.y);
+    return {left, top, transformX(rect.x + rect.w) - left, transformY(rect.y + rect.h) - top};
+}
+
+/**
+ * @brief Appends a command with everything but its type and color zeroed
+ */
+RenderCommand& RenderCommandBuffer::push(RenderCommandType type, const SDL_Color& color)
+{
+    RenderCommand command = {};
+    command.type = type;
+    command.color = color;
+    command.flip = SDL_FLIP_NONE;
+    command.align = TextAlign::LEFT;
+    commands.push_back(command);
+    return commands.back();
+}
+
+/**
+ * @brief Fills the whole target with a color
+ */
+void RenderCommandBuffer::clear(const SDL_Color& color)
+{
+    push(RenderCommandType::CLEAR, color);
+}
+
+/**
+ * @brief Draws a whole texture stretched over a rect
+ * @param texture Texture owned by a TextureManager; must outlive the replay
+ * @param dst Destination rect
+ * @param flip Mirroring
+ */
+void RenderCommandBuffer::sprite(SDL_Texture* texture, const SDL_Rect& dst, SDL_RendererFlip flip)
+{
+    RenderCommand& command = push(RenderCommandType::SPRITE, {255, 255, 255, 255});
+    command.texture = texture;
+    command.rect = transform(dst);
+    command.flip = flip;
+}
+
+/**
+ * @brief Draws part of a texture stretched over a rect
+ * @param texture Texture that must outlive the replay
+ * @param source Region of the texture in texels
+ * @param dst Destination rect
+ */
+void RenderCommandBuffer::spriteRegion(SDL_Texture* texture, const SDL_Rect& source, const SDL_Rect& dst)
+{
+    RenderCommand& command = push(RenderCommandType::SPRITE, {255, 255, 255, 255});
+    command.texture = texture;
+    command.source = source;
+    command.rect = transform(dst);
+}
+
+/**
+ * @brief Draws a whole texture stretched over a rect and rotated about the rect's center
+ * @param texture Texture owned by a TextureManager; must outlive the replay
+ * @param dst Destination rect before rotation
+ * @param angle Clockwise rotation in degrees
+ * @param flip Mirroring
+ */
+void RenderCommandBuffer::rotatedSprite(SDL_Texture* texture, const SDL_Rect& dst, double angle, SDL_RendererFlip flip)
+{
+    RenderCommand& command = push(RenderCommandType::ROTATED_SPRITE, {255, 255, 255, 255});
+    command.texture = texture;
+    command.rect = transform(dst);
+    command.angle = angle;
+    command.flip = flip;
+}
+
+/**
+ * @brief Fills a rect, alpha blended
+ */
+void RenderCommandBuffer::fillRect(const SDL_Rect& rect, const SDL_Color& color)
+{
+    push(RenderCommandType::FILL_RECT, color).rect = transform(rect);
+}
+
+/**
+ * @brief Draws a one pixel rect outline, alpha blended
+ */
+void RenderCommandBuffer::outlineRect(const SDL_Rect& rect, const SDL_Color& color)
+{
+    push(RenderCommandType::OUTLINE_RECT, color).rect = transform(rect);
+}
+
+/**
+ * @brief Draws a line of text, rasterized at replay since its size depends on the font
+ * @param font Font to use; must stay open until the replay
+ * @param pointSize Size to set on the font before rendering
+ * @param str Text, copied into the buffer
+ * @param area Area the text is aligned in
+ * @param color Text color
+ * @param align Placement of the text inside the area
+ */
+void RenderCommandBuffer::text(TTF_Font* font, int pointSize, const std::string& str, const SDL_Rect& area,
+    const SDL_Color& color, TextAlign align)
+{
+    text(font, pointSize, str.c_str(), area, color, align);
+}
+
+/**
+ * @brief Same as the std::string version, for text formatted into a stack buffer
+ * @param str Null-terminated text, copied into the buffer
+ */
+void RenderCommandBuffer::text(TTF_Font* font, int pointSize, const char* str, const SDL_Rect& area,
+    const SDL_Color& color, TextAlign align)
+{
+    if (!font || !str || str[0] == '\0') {
+        return;
+    }
+    RenderCommand& command = push(RenderCommandType::TEXT, color);
+    command.font = font;
+    command.size = pointSize;
+    command.rect = transform(area);
+    command.align = align;
+    command.textOffset = textStorage.size();
+    textStorage.append(str);
+    textStorage.push_back('\0'); // Capacity is kept across reset(), so steady frames don't allocate
+}
+
+/**
+ * @brief Draws an ellipse outline
+ * @param x Center x
+ * @param y Center y
+ * @param rx Horizontal radius
+ * @param ry Vertical radius
+ * @param color Outline color
+ */
+void RenderCommandBuffer::ellipse(int x, int y, int rx, int ry, const SDL_Color& color)
+{
+    RenderCommand& command = push(RenderCommandType::ELLIPSE, color);
+    command.rect = {transformX(x), transformY(y),
+                    static_cast<int>(std::lround(rx * scaleX)), static_cast<int>(std::lround(ry * scaleY))};
+}
+
+/**
+ * @brief Draws a line of a given width
+ * @param width Line width, scaled with the vertical scale
+ */
+void RenderCommandBuffer::thickLine(int x1, int y1, int x2, int y2, int width, const SDL_Color& color)
+{
+    RenderCommand& command = push(RenderCommandType::THICK_LINE, color);
+    command.rect = {transformX(x1), transformY(y1), transformX(x2), transformY(y2)};
+    command.size = std::max(1, static_cast<int>(std::lround(width * scaleY)));
+}
+
+/**
+ * @brief Draws a polyline of a given width as one batch of triangles
+ * @details Each point becomes two vertices offset either side along the line's local normal,
+ * in window pixels so the width stays even under a stretched transform. Without
+ * SDL_RenderGeometry (SDL before 2.0.18) the segments are drawn as thick lines instead.
+ * @param points Points in recording units
+ * @param count Number of points, at least 2 to draw anything
+ * @param width Line width, scaled with the vertical scale
+ */
+void RenderCommandBuffer::lineStrip(const Vector2D* points, int count, float width, const SDL_Color& color)
+{
+    if (count < 2) {
+        return;
+    }
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    float halfWidth = std::max(1.0f, width * scaleY) * 0.5f;
+    int firstVertex = static_cast<int>(vertexStorage.size());
+    RenderCommand& command = push(RenderCommandType::GEOMETRY, color);
+    command.textOffset = indexStorage.size();
+    command.size = (count - 1) * 6;
+
+    for (int k = 0; k < count; k++) {
+        const Vector2D& before = points[std::max(k - 1, 0)];
+        const Vector2D& after = points[std::min(k + 1, count - 1)];
+        float dx = (after.x - before.x) * scaleX;
+        float dy = (after.y - before.y) * scaleY;
+        float length = std::sqrt(dx * dx + dy * dy);
+        float normalX = length > 0.0f ? -dy / length * halfWidth : halfWidth;
+        float normalY = length > 0.0f ? dx / length * halfWidth : 0.0f;
+        float px = points[k].x * scaleX + offsetX;
+        float py = points[k].y * scaleY + offsetY;
+        vertexStorage.push_back({{px + normalX, py + normalY}, color, {0.0f, 0.0f}});
+        vertexStorage.push_back({{px - normalX, py - normalY}, color, {0.0f, 0.0f}});
+    }
+    for (int k = 0; k < count - 1; k++) {
+        int left = firstVertex + 2 * k;
+        int quad[6] = {left, left + 1, left + 2, left + 1, left + 3, left + 2};
+        indexStorage.insert(indexStorage.end(), quad, quad + 6);
+    }
+#else
+    int lineWidth = std::max(1, static_cast<int>(std::lround(width)));
+    for (int k = 0; k < count - 1; k++) {
+        thickLine(static_cast<int>(points[k].x), static_cast<int>(points[k].y),
+                  static_cast<int>(points[k + 1].x), static_cast<int>(points[k + 1].y), lineWidth, color);
+    }
+#endif
+}
+
+/**
+ * @brief Draws filled squares, each in its own color, as one batch of triangles
+ * @details Made for particle pools, so it takes structure-of-arrays input. Without
+ * SDL_RenderGeometry (SDL before 2.0.18) each square becomes a fill rect instead.
+ * @param centerX Square centers, recording units
+ * @param centerY Square centers
+ * @param halfSize Half of each square's side, scaled like positions
+ * @param colors Fill colors, alpha blended
+ * @param count Number of squares
+ */
+void RenderCommandBuffer::squares(const float* centerX, const float* centerY, const float* halfSize,
+    const SDL_Color* colors, int count)
+{
+    if (count <= 0) {
+        return;
+    }
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    int firstVertex = static_cast<int>(vertexStorage.size());
+    RenderCommand& command = push(RenderCommandType::GEOMETRY, {255, 255, 255, 255});
+    command.textOffset = indexStorage.size();
+    command.size = count * 6;
+
+    size_t vertexEnd = vertexStorage.size() + static_cast<size_t>(count) * 4;
+    size_t indexEnd = indexStorage.size() + static_cast<size_t>(count) * 6;
+    vertexStorage.resize(vertexEnd);
+    indexStorage.resize(indexEnd);
+    SDL_Vertex* vertex = vertexStorage.data() + firstVertex;
+    int* index = indexStorage.data() + command.textOffset;
+    for (int i = 0; i < count; i++) {
+        float x = centerX[i] * scaleX + offsetX;
+        float y = centerY[i] * scaleY + offsetY;
+        float w = halfSize[i] * scaleX;
+        float h = halfSize[i] * scaleY;
+        const SDL_Color& c = colors[i];
+        vertex[0] = {{x - w, y - h}, c, {0.0f, 0.0f}};
+        vertex[1] = {{x + w, y - h}, c, {0.0f, 0.0f}};
+        vertex[2] = {{x + w, y + h}, c, {0.0f, 0.0f}};
+        vertex[3] = {{x - w, y + h}, c, {0.0f, 0.0f}};
+        vertex += 4;
+
+        int first = firstVertex + i * 4;
+        index[0] = first;
+        index[1] = first + 1;
+        index[2] = first + 2;
+        index[3] = first;
+        index[4] = first + 2;
+        index[5] = first + 3;
+        index += 6;
+    }
+#else
+    for (int i = 0; i < count; i++) {
+        int side = std::max(1, static_cast<int>(2 * halfSize[i]));
+        fillRect({static_cast<int>(centerX[i] - halfSize[i]), static_cast<int>(centerY[i] - halfSize[i]), side, side}, colors[i]);
+    }
+#endif
+}
+
+/**
+ * @brief Replaces a streaming texture's pixels at replay, before the commands recorded after this
+ * @param texture Texture created with SDL_TEXTUREACCESS_STREAMING in a 32-bit format
+ * @param pixels Rows of width pixels, packed, copied into the buffer
+ * @param width Texture width
+ * @param height Texture height
+ */
+void RenderCommandBuffer::updateTexture(SDL_Texture* texture, const Uint32* pixels, int width, int height)
+{
+    if (!texture || width <= 0 || height <= 0) {
+        return;
+    }
+    RenderCommand& command = push(RenderCommandType::UPDATE_TEXTURE, {255, 255, 255, 255});
+    command.texture = texture;
+    command.rect = {0, 0, width, height};
+    command.textOffset = pixelStorage.size();
+    pixelStorage.insert(pixelStorage.end(), pixels, pixels + static_cast<size_t>(width) * height);
+}
+
+/**
+ * @brief Limits drawing to a rect in window pixels (not transformed)
+ * @param clip Area to draw in, nullptr to draw anywhere again
+ */
+void RenderCommandBuffer::setClip(const SDL_Rect* clip)
+{
+    RenderCommand& command = push(RenderCommandType::CLIP, {0, 0, 0, 0});
+    if (clip) {
+        command.rect = *clip;
+        command.size = 1;
+    }
+}
+
+/**
+ * @brief Draws the commands recorded after this into a texture instead of the window
+ * @param texture Texture created with SDL_TEXTUREACCESS_TARGET, nullptr for the window again
+ */
+void RenderCommandBuffer::setTarget(SDL_Texture* texture)
+{
+    RenderCommand& command = push(RenderCommandType::TARGET, {0, 0, 0, 0});
+    command.texture = texture;
+}
+
+/**
+ * @brief Issues every recorded command to a renderer; call on the thread that owns it
+ * @param renderer Target renderer
+ */
+void RenderCommandBuffer::replay(SDL_Renderer* renderer) const
+{
+    bool retargeted = false;
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    for (const RenderCommand& command : commands) {
+        const SDL_Color& c = command.color;
+        const SDL_Rect& r = command.rect;
+        switch (command.type) {
+            case RenderCommandType::CLEAR:
+                SDL_SetRenderDrawColor(renderer, c.r, c.g, c.b, c.a);
+                SDL_RenderClear(renderer);
+                break;
+            case RenderCommandType::SPRITE:
+                SDL_RenderCopyEx(renderer, command.texture, command.source.w > 0 ? &command.source : nullptr, &r, 0, nullptr, command.flip);
+                break;
+            case RenderCommandType::ROTATED_SPRITE:
+                SDL_RenderCopyEx(renderer, command.texture, nullptr, &r, command.angle, nullptr, command.flip);
+                break;
+            case RenderCommandType::FILL_RECT:
+                SDL_SetRenderDrawColor(renderer, c.r, c.g, c.b, c.a);
+                SDL_RenderFillRect(renderer, &r);
+                break;
+            case RenderCommandType::OUTLINE_RECT:
+                SDL_SetRenderDrawColor(renderer, c.r, c.g, c.b, c.a);
+                SDL_RenderDrawRect(renderer, &r);
+                break;
+            case RenderCommandType::TEXT:
+                replayText(renderer, command);
+                break;
+            case RenderCommandType::ELLIPSE:
+                ellipseRGBA(renderer, r.x, r.y, r.w, r.h, c.r, c.g, c.b, c.a);
+                break;
+            case RenderCommandType::THICK_LINE:
+                thickLineRGBA(renderer, r.x, r.y, r.w, r.h, command.size, c.r, c.g, c.b, c.a);
+                break;
+            case RenderCommandType::GEOMETRY:
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+                if (SDL_RenderGeometry(renderer, nullptr, vertexStorage.data(), static_cast<int>(vertexStorage.size()),
+                                       indexStorage.data() + command.textOffset, command.size) != 0) {
+                    std::cerr << "Failed to draw geometry: " << SDL_GetError() << std::endl;
+                }
+#endif
+                break;
+            case RenderCommandType::UPDATE_TEXTURE:
+                replayTextureUpdate(command);
+                break;
+            case RenderCommandType::CLIP:
+                SDL_RenderSetClipRect(renderer, command.size ? &r : nullptr);
+                break;
+            case RenderCommandType::TARGET:
+                if (SDL_SetRenderTarget(renderer, command.texture) != 0) {
+                    std::cerr << "Failed to set render target: " << SDL_GetError() << std::endl;
+                }
+                retargeted = true;
+                break;
+        }
+    }
+    if (retargeted) {
+        SDL_SetRenderTarget(renderer, nullptr); // Present the window even if a frame forgot to switch back
+    }
+    SDL_RenderSetClipRect(renderer, nullptr);
+}
+
+/**
+ * @brief replay() plus a flush of the renderer's batched work, timed
+ * @details SDL has no GPU timer queries; a driver that is behind on GPU work blocks in the
+ * flush, so this is the closest measure of the frame's render cost available.
+ * @param renderer Target renderer
+ * @return double milliseconds spent
+ */
+double RenderCommandBuffer::replayTimed(SDL_Renderer* renderer) const
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+    replay(renderer);
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+    SDL_RenderFlush(renderer);
+#endif
+    return (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+/**
+ * @brief Rasterizes one text run and copies it into place
+ */
+void RenderCommandBuffer::replayText(SDL_Renderer* renderer, const RenderCommand& command) const
+{
+    const char* str = textStorage.c_str() + command.textOffset;
+    TTF_SetFontSize(command.font, command.size);
+
+    SDL_Surface* surface = TTF_RenderText_Blended(command.font, str, command.color);
+    if (!surface) {
+        std::cerr << "Failed to create text surface for '" << str << "': " << TTF_GetError() << std::endl;
+        return;
+    }
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (!texture) {
+        std::cerr << "Failed to create texture from text surface: " << SDL_GetError() << std::endl;
+        SDL_FreeSurface(surface);
+        return;
+    }
+
+    const SDL_Rect& area = command.rect;
+    SDL_Rect location = {area.x, area.y, surface->w, surface->h};
+    if (command.align != TextAlign::LEFT) {
+        location.x = area.x + (area.w - surface->w) / 2;
+    }
+    if (command.align == TextAlign::CENTER) {
+        location.y = area.y + (area.h - surface->h) / 2;
+    }
+
+    SDL_RenderCopy(renderer, texture, nullptr, &location);
+    SDL_FreeSurface(surface);
+    SDL_DestroyTexture(texture);
+}
+
+/**
+ * @brief Copies recorded pixels into a locked streaming texture, row by row to honour its pitch
+ */
+void RenderCommandBuffer::replayTextureUpdate(const RenderCommand& command) const
+{
+    void* locked = nullptr;
+    int pitch = 0;
+    if (SDL_LockTexture(command.texture, nullptr, &locked, &pitch) != 0) {
+        std::cerr << "Failed to lock streaming texture: " << SDL_GetError() << std::endl;
+        return;
+    }
+    const Uint32* source = pixelStorage.data() + command.textOffset;
+    size_t rowBytes = static_cast<size_t>(command.rect.w) * sizeof(Uint32);
+    for (int row = 0; row < command.rect.h; row++) {
+        std::memcpy(static_cast<Uint8*>(locked) + static_cast<size_t>(row) * pitch, source, rowBytes);
+        source += command.rect.w;
+    }
+    SDL_UnlockTexture(command.texture);
+}
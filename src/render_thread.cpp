@@ -0,0 +1,175 @@
+#include <iostream> // For status messages
+
+#include "render_thread.hpp" // Class header
+
+std::atomic<RenderThread*> RenderThread::active(nullptr);
+
+/**
+ * @brief Starts the render thread and waits until it has created the renderer
+ * @param createRenderer Called on the render thread; throws or returns nullptr on failure
+ */
+RenderThread::RenderThread(const std::function<SDL_Renderer*()>& createRenderer)
+{
+    thread = std::thread(&RenderThread::threadLoop, this, createRenderer);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        progress.wait(lock, [this] { return ready; });
+    }
+
+    if (creationError || !renderer) {
+        thread.join();
+        if (creationError) {
+            std::rethrow_exception(creationError);
+        }
+        throw std::runtime_error("Render thread could not create a renderer");
+    }
+
+    active = this;
+    std::cout << "RenderThread: Rendering on a dedicated thread" << std::endl;
+}
+
+/**
+ * @brief Replays whatever was submitted, destroys the renderer on its thread and joins it
+ */
+RenderThread::~RenderThread()
+{
+    active = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Buffer to record the next frame into; waits if it is still queued or replaying
+ * @return RenderCommandBuffer& empty buffer
+ */
+RenderCommandBuffer& RenderThread::beginFrame()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    progress.wait(lock, [this] { return states[recordIndex] == FrameState::FREE; });
+    frames[recordIndex].reset();
+    return frames[recordIndex];
+}
+
+/**
+ * @brief Queues the buffer from beginFrame() for replay and present
+ */
+void RenderThread::submitFrame()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        states[recordIndex] = FrameState::PENDING;
+        recordIndex ^= 1;
+    }
+    wake.notify_one();
+}
+
+/**
+ * @brief Runs a task on the render thread after every submitted frame and waits for it
+ * @param task Work that touches the renderer or fonts
+ */
+void RenderThread::invoke(const std::function<void()>& task)
+{
+    if (std::this_thread::get_id() == thread.get_id()) {
+        task();
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    tasks.push_back(task);
+    unsigned long long ticket = ++tasksQueued;
+    wake.notify_one();
+    progress.wait(lock, [this, ticket] { return tasksDone >= ticket; });
+}
+
+/**
+ * @brief Sets a callback run on the render thread right after each frame is presented
+ * @param listener Receives the presented frame, e.g. to read its input timestamp
+ */
+void RenderThread::setPresentListener(const std::function<void(const RenderCommandBuffer&)>& listener)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    presentListener = listener;
+}
+
+/**
+ * @brief Runs a task on the active render thread, or right here when rendering is single threaded
+ * @param task Work that touches the renderer or fonts
+ */
+void RenderThread::runOnRenderer(const std::function<void()>& task)
+{
+    RenderThread* renderThread = active;
+    if (renderThread) {
+        renderThread->invoke(task);
+    } else {
+        task();
+    }
+}
+
+/**
+ * @brief Render thread body: creates the renderer, then replays frames and runs tasks in order
+ * @param createRenderer Renderer factory from the constructor
+ */
+void RenderThread::threadLoop(std::function<SDL_Renderer*()> createRenderer)
+{
+    SDL_Renderer* created = nullptr;
+    std::exception_ptr error;
+    try {
+        created = createRenderer();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        renderer = created;
+        creationError = error;
+        ready = true;
+    }
+    progress.notify_all();
+    if (!created) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] {
+            return stopping || states[replayIndex] == FrameState::PENDING || !tasks.empty();
+        });
+
+        // Frames first: tasks may free textures those frames still draw
+        if (states[replayIndex] == FrameState::PENDING) {
+            int index = replayIndex;
+            states[index] = FrameState::REPLAYING;
+            std::function<void(const RenderCommandBuffer&)> listener = presentListener;
+            lock.unlock();
+            lastReplayMs.store(frames[index].replayTimed(renderer), std::memory_order_relaxed);
+            replayedFrames.fetch_add(1, std::memory_order_release);
+            SDL_RenderPresent(renderer); // May block on vsync; only this thread waits
+            if (listener) {
+                listener(frames[index]);
+            }
+            lock.lock();
+            states[index] = FrameState::FREE;
+            replayIndex ^= 1;
+            progress.notify_all();
+        } else if (!tasks.empty()) {
+            std::function<void()> task = std::move(tasks.front());
+            tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+            tasksDone++;
+            progress.notify_all();
+        } else if (stopping) {
+            break;
+        }
+    }
+    lock.unlock();
+
+    SDL_DestroyRenderer(renderer);
+}
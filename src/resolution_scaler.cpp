@@ -0,0 +1,88 @@
+#include <algorithm> // For clamps
+#include <cmath> // For the pixel-count model
+
+#include "resolution_scaler.hpp" // Class header
+
+namespace
+{
+    const double HEADROOM = 0.8;    // Share of the budget a new scale should be expected to use
+}
+
+/**
+ * @brief Starts at the largest scale allowed
+ * @param minScale Smallest scale, above 0
+ * @param maxScale Largest scale, at most 1 (the window's own resolution)
+ */
+ResolutionScaler::ResolutionScaler(float minScale, float maxScale)
+{
+    setBounds(minScale, maxScale);
+}
+
+/**
+ * @brief Changes the allowed range and restarts at its top
+ * @param minScale Smallest scale, above 0
+ * @param maxScale Largest scale, at most 1; equal bounds fix the scale
+ */
+void ResolutionScaler::setBounds(float minScale, float maxScale)
+{
+    this->maxScale = std::min(1.0f, std::max(Visuals::RENDER_SCALE_STEP, maxScale));
+    this->minScale = std::min(this->maxScale, std::max(Visuals::RENDER_SCALE_STEP, minScale));
+    scale = this->maxScale;
+    sampleCount = 0;
+    calmFrames = 0;
+}
+
+/**
+ * @brief Adds one frame's render time and adjusts the scale
+ * @param renderMs Time to render the frame at the current scale
+ * @return bool true if the scale changed
+ */
+bool ResolutionScaler::addSample(double renderMs)
+{
+    samples[sampleCount % WINDOW] = renderMs;
+    sampleCount++;
+    if (sampleCount < WINDOW) {
+        return false;
+    }
+    double average = 0.0;
+    for (double sample : samples) {
+        average += sample;
+    }
+    average /= WINDOW;
+
+    // Cost is taken to follow the pixel count, the square of the scale
+    float next = scale;
+    float larger = scale + Visuals::RENDER_SCALE_STEP;
+    if (average > budgetMs) {
+        next = static_cast<float>(scale * std::sqrt(budgetMs * HEADROOM / average));
+        next = std::min(quantize(next), scale - Visuals::RENDER_SCALE_STEP);
+        calmFrames = 0;
+    } else if (average * (larger / scale) * (larger / scale) < budgetMs * HEADROOM) {
+        if (++calmFrames >= GROW_DELAY) {
+            next = larger;
+            calmFrames = 0;
+        }
+    } else {
+        calmFrames = 0;
+    }
+
+    next = quantize(std::min(maxScale, std::max(minScale, next)));
+    if (std::fabs(next - scale) < Visuals::RENDER_SCALE_STEP / 2) {
+        return false;
+    }
+    scale = next;
+    sampleCount = 0; // Judge the new scale on its own frames
+    return true;
+}
+
+/**
+ * @brief Rounds down to a whole step, except onto the bounds themselves
+ */
+float ResolutionScaler::quantize(float value) const
+{
+    if (value >= maxScale || value <= minScale) {
+        return std::min(maxScale, std::max(minScale, value));
+    }
+    float steps = std::floor(value / Visuals::RENDER_SCALE_STEP + 0.001f);
+    return std::max(minScale, steps * Visuals::RENDER_SCALE_STEP);
+}
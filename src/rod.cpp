@@ -1,20 +1,21 @@
 #include "rod.hpp" // Class headerfile
 #include "game_constants.hpp" // For rod speed/size
-#include "scaling.hpp" // For scaling helpers
 
-Rod::Rod(float speedMultiplier) : position(Vector2D(Dimens::CENTER_X, Dimens::CENTER_Y)), 
+Rod::Rod(float speedMultiplier, const WorldMetrics& metrics) : position(Vector2D(metrics.centerX, metrics.centerY)), 
              direction(Vector2D(0, 1)), 
-             speed(Vector2D(0, Game::ROD_SPEED * Scale::getHeightScaleFactor() * speedMultiplier)), 
+             speed(Vector2D(0, metrics.rodSpeed * speedMultiplier)), 
              dimens(Vector2D(Game::ROD_RADIUSX_PERCENT, Game::ROD_RADIUSY_PERCENT)),
              velocity(0),
-             maxVelocity(Game::ROD_SPEED * Scale::getHeightScaleFactor() * speedMultiplier) {}
+             maxVelocity(metrics.rodSpeed * speedMultiplier),
+             minY(metrics.rodMinY),
+             maxY(metrics.rodMaxY) {}
 
 /**
  * @brief moves the rod upwards and checks bounds
  */
 void Rod::castUp() {
     velocity = -maxVelocity;
-    direction[1] = -1;
+    direction.y = -1;
 }
 
 /**
@@ -22,7 +23,7 @@ void Rod::castUp() {
  */
 void Rod::castDown() {
     velocity = maxVelocity;
-    direction[1] = 1;
+    direction.y = 1;
 }
 
 /**
@@ -31,7 +32,7 @@ void Rod::castDown() {
  */
 void Rod::castUpSpeed(float customSpeed) {
     velocity = -customSpeed;
-    direction[1] = -1;
+    direction.y = -1;
 }
 
 /**
@@ -40,7 +41,7 @@ void Rod::castUpSpeed(float customSpeed) {
  */
 void Rod::castDownSpeed(float customSpeed) {
     velocity = customSpeed;
-    direction[1] = 1;
+    direction.y = 1;
 }
 
 void Rod::stopMovement() {
@@ -48,17 +49,14 @@ void Rod::stopMovement() {
 }
 
 void Rod::updatePos() {
-    float maxRod = Scale::scaleH(Game::ROD_MAX_LENGTH_PERCENT);
-    float minRod = Scale::scaleH(Game::ROD_MIN_LENGTH_PERCENT);
-
     if (velocity != 0) {
-        float newY = position[1] + velocity;
+        float newY = position.y + velocity;
 
-        if (newY > minRod && newY < maxRod) {
-            position[1] = newY;
+        if (newY > minY && newY < maxY) {
+            position.y = newY;
         } else {
-            if (newY <= minRod) position[1] = minRod;
-            if (newY >= maxRod) position[1] = maxRod;
+            if (newY <= minY) position.y = minY;
+            if (newY >= maxY) position.y = maxY;
             velocity = 0;
         }
     }
@@ -1,4 +1,5 @@
 #include "store_view.hpp"
+#include "frame_arena.hpp" // For per-frame stat strings
 
 StoreView::StoreView(const shared_ptr<GameNotifier>& notifier, SDL_Window* window, 
                     SDL_Renderer* renderer, PlayerData& playerData) :
@@ -18,15 +19,9 @@ StoreView::StoreView(const shared_ptr<GameNotifier>& notifier, SDL_Window* windo
     {
         color = {Colors::Black::R, Colors::Black::G, Colors::Black::B, Colors::Black::A};
 
-        // Set font sizes
+        // Store buttons use a smaller font than the menu
         int buttonFontSize = Scale::scaleFontSize(Visuals::STORE_BUTTON_FONT_SIZE);
         int hoverFontSize = Scale::scaleFontSize(Visuals::HOVER_FONT_SIZE);
-        if (font) {
-            TTF_SetFontSize(font, buttonFontSize);
-        }
-        if (hoverFont) {
-            TTF_SetFontSize(hoverFont, hoverFontSize);
-        }
         
         // Scale button positions/set hover text
         updateResolution();
@@ -46,6 +41,12 @@ StoreView::StoreView(const shared_ptr<GameNotifier>& notifier, SDL_Window* windo
         saveGameButton.setFonts(font, hoverFont);
         exitButton.setFonts(font, hoverFont);
 
+        // Set font sizes
+        for (TextBox* button : {&upgrade1, &upgrade2, &upgrade3, &upgrade4, &payLoanButton,
+                                &fishingButton, &saveGameButton, &exitButton, &resetTutorial}) {
+            button->setFontSizes(buttonFontSize, hoverFontSize);
+        }
+
         // Load static background DEPRECATED
         if (!textureManager.loadTexture(Resource::BG_STORE_ID, Resource::BG_STORE)) {
             std::cerr << "Failed to load store background" << std::endl;
@@ -59,6 +60,8 @@ StoreView::StoreView(const shared_ptr<GameNotifier>& notifier, SDL_Window* windo
         if (!textureManager.loadTexture(Resource::BG_STORE_ANIM2_ID, Resource::BG_STORE_ANIM2)) {
             std::cerr << "Failed to load store background animation frame 2" << std::endl;
         }
+        backgroundAnimation = textureManager.addAnimation(Resource::BG_STORE_ANIM1_ID, Resource::BG_STORE_ANIM2_ID,
+            Game::BACKGROUND_ANIMATION_DELAY);
     }
 
 StoreView::~StoreView() {
@@ -164,36 +167,36 @@ void StoreView::mouseClick(float x, float y) {
     }
 }
 
-void StoreView::renderStore() {        
+void StoreView::renderStore(RenderCommandBuffer& commands) {        
     // Draw upgrade buttons
-    upgrade1.renderBox(renderer, color);
-    upgrade2.renderBox(renderer, color);
-    upgrade3.renderBox(renderer, color);
-    upgrade4.renderBox(renderer, color);
+    upgrade1.renderBox(commands, color);
+    upgrade2.renderBox(commands, color);
+    upgrade3.renderBox(commands, color);
+    upgrade4.renderBox(commands, color);
     
     // Draw pay loan button (disabled if loan is paid off or insufficient cash)
     if (playerData.getLoanAmount() <= 0) {
         // Gray out the button if loan is paid off
         SDL_Color grayColor = {150, 150, 150, 255};
-        payLoanButton.renderBox(renderer, grayColor);
+        payLoanButton.renderBox(commands, grayColor);
     } else if (playerData.getCash() < loan_payment_amount) {
         // Gray out the button if insufficient cash
         SDL_Color grayColor = {150, 150, 150, 255};
-        payLoanButton.renderBox(renderer, grayColor);
+        payLoanButton.renderBox(commands, grayColor);
     } else {
-        payLoanButton.renderBox(renderer, color);
+        payLoanButton.renderBox(commands, color);
     }
     
-    fishingButton.renderBox(renderer, color);
-    saveGameButton.renderBox(renderer, color);
-    exitButton.renderBox(renderer, color);
-    resetTutorial.renderBox(renderer, color);
+    fishingButton.renderBox(commands, color);
+    saveGameButton.renderBox(commands, color);
+    exitButton.renderBox(commands, color);
+    resetTutorial.renderBox(commands, color);
 
     // Draw player statistics in bottom left
-    drawPlayerStats();
+    drawPlayerStats(commands);
 }
 
-void StoreView::drawPlayerStats() {
+void StoreView::drawPlayerStats(RenderCommandBuffer& commands) {
     // Position stats box
     float boxWidthPercent = 0.15f;
     float boxHeightPercent = 0.16f;
@@ -208,56 +211,35 @@ void StoreView::drawPlayerStats() {
     // Draw background for stats (tan colored box with border)
     SDL_Rect statsRect = {baseX, baseY, width, height};
     
-    SDL_SetRenderDrawColor(renderer, Colors::Tan::R, Colors::Tan::G, Colors::Tan::B, Colors::Tan::ATrans); // Background
-    SDL_RenderFillRect(renderer, &statsRect);
-    SDL_SetRenderDrawColor(renderer, Colors::Brown::R, Colors::Brown::G, Colors::Brown::B, Colors::Brown::A); // Outer border 
-    SDL_RenderDrawRect(renderer, &statsRect);
+    commands.fillRect(statsRect, {Colors::Tan::R, Colors::Tan::G, Colors::Tan::B, Colors::Tan::ATrans}); // Background
+    commands.outlineRect(statsRect, {Colors::Brown::R, Colors::Brown::G, Colors::Brown::B, Colors::Brown::A}); // Outer border 
     SDL_Rect innerRect = {baseX + 2, baseY + 2, width - 4, height - 4}; // Inner border
-    SDL_SetRenderDrawColor(renderer, Colors::Wheat::R, Colors::Wheat::G, Colors::Wheat::B, Colors::Wheat::A);
-    SDL_RenderDrawRect(renderer, &innerRect);
+    commands.outlineRect(innerRect, {Colors::Wheat::R, Colors::Wheat::G, Colors::Wheat::B, Colors::Wheat::A});
     
     // Use scaled font sizes for headers and text
     int headerFontSize = Scale::scaleFontSize(Visuals::STATS_HEADER_FONT_SIZE);
     int textFontSize = Scale::scaleFontSize(Visuals::STATS_TEXT_FONT_SIZE);
-    TTF_SetFontSize(font, headerFontSize);
     int textXOffset = static_cast<int>(width * 0.05f);
     int textX = baseX + textXOffset;
     SDL_Color textColor = {Colors::Black::R, Colors::Black::G, Colors::Black::B, Colors::Black::A};
     
     // Render player stats header
-    SDL_Surface* headerSurface = TTF_RenderText_Blended(font, "Player Stats:", textColor);
-    SDL_Texture* headerTexture = SDL_CreateTextureFromSurface(renderer, headerSurface);
-    SDL_Rect headerRect = {textX, baseY, headerSurface->w, headerSurface->h};
-    SDL_RenderCopy(renderer, headerTexture, NULL, &headerRect);
-    SDL_FreeSurface(headerSurface);
-    SDL_DestroyTexture(headerTexture);
-    
-    // Change font size for regular text
-    TTF_SetFontSize(font, textFontSize);
+    commands.text(font, headerFontSize, "Player Stats:", {textX, baseY, 0, 0}, textColor);
     
     // Draw each line with even spacing
     float lineSpacingPercent = 0.12f;
     int lineSpacing = static_cast<int>(height * lineSpacingPercent);
     int yOffset = static_cast<int>(height * 0.20f);
     
+    // Stat lines are formatted into the frame arena; they only live until the commands are recorded
+    FrameArena& arena = FrameArena::perFrame();
+
     // Day count
-    std::string dayText = "Day: " + std::to_string(playerData.getDayCount());
-    SDL_Surface* daySurface = TTF_RenderText_Blended(font, dayText.c_str(), textColor);
-    SDL_Texture* dayTexture = SDL_CreateTextureFromSurface(renderer, daySurface);
-    SDL_Rect dayRect = {textX, baseY + yOffset, daySurface->w, daySurface->h};
-    SDL_RenderCopy(renderer, dayTexture, NULL, &dayRect);
-    SDL_FreeSurface(daySurface);
-    SDL_DestroyTexture(dayTexture);
+    commands.text(font, textFontSize, arena.format("Day: %d", playerData.getDayCount()), {textX, baseY + yOffset, 0, 0}, textColor);
     yOffset += lineSpacing;
         
     // Cash
-    std::string cashText = "Cash: $" + std::to_string(playerData.getCash());
-    SDL_Surface* cashSurface = TTF_RenderText_Blended(font, cashText.c_str(), textColor);
-    SDL_Texture* cashTexture = SDL_CreateTextureFromSurface(renderer, cashSurface);
-    SDL_Rect cashRect = {textX, baseY + yOffset, cashSurface->w, cashSurface->h};
-    SDL_RenderCopy(renderer, cashTexture, NULL, &cashRect);
-    SDL_FreeSurface(cashSurface);
-    SDL_DestroyTexture(cashTexture);
+    commands.text(font, textFontSize, arena.format("Cash: $%d", playerData.getCash()), {textX, baseY + yOffset, 0, 0}, textColor);
     yOffset += lineSpacing;
     
     // Loan amount
@@ -268,74 +250,40 @@ void StoreView::drawPlayerStats() {
         loanColor = {180, 0, 0, 255}; // Red for not
     }
     
-    std::string loanText = "Loan: $" + std::to_string(playerData.getLoanAmount());
-    if (playerData.getLoanAmount() <= 0) {
-        loanText = "Loan: PAID OFF!";
+    const char* loanText = "Loan: PAID OFF!";
+    if (playerData.getLoanAmount() > 0) {
+        loanText = arena.format("Loan: $%d", playerData.getLoanAmount());
     }
     
-    SDL_Surface* loanSurface = TTF_RenderText_Blended(font, loanText.c_str(), loanColor);
-    SDL_Texture* loanTexture = SDL_CreateTextureFromSurface(renderer, loanSurface);
-    SDL_Rect loanRect = {textX, baseY + yOffset, loanSurface->w, loanSurface->h};
-    SDL_RenderCopy(renderer, loanTexture, NULL, &loanRect);
-    SDL_FreeSurface(loanSurface);
-    SDL_DestroyTexture(loanTexture);
+    commands.text(font, textFontSize, loanText, {textX, baseY + yOffset, 0, 0}, loanColor);
     yOffset += lineSpacing;
     
     // Ledger income (if any)
     if (playerData.getLedgerIncome() > 0) {
-        std::string ledgerText = "Ledger Income: $" + std::to_string(playerData.getLedgerIncome()) + "/day";
-        SDL_Surface* ledgerSurface = TTF_RenderText_Blended(font, ledgerText.c_str(), textColor);
-        SDL_Texture* ledgerTexture = SDL_CreateTextureFromSurface(renderer, ledgerSurface);
-        SDL_Rect ledgerRect = {textX, baseY + yOffset, ledgerSurface->w, ledgerSurface->h};
-        SDL_RenderCopy(renderer, ledgerTexture, NULL, &ledgerRect);
-        SDL_FreeSurface(ledgerSurface);
-        SDL_DestroyTexture(ledgerTexture);
+        commands.text(font, textFontSize, arena.format("Ledger Income: $%d/day", playerData.getLedgerIncome()),
+            {textX, baseY + yOffset, 0, 0}, textColor);
         yOffset += lineSpacing;
     }
     
     // Cash multiplier (if any)
     if (playerData.getRegisterLevel() > 0) {
-        std::ostringstream multiplierStream;
-        multiplierStream << std::fixed << std::setprecision(2) << playerData.getCashMultiplier();
-        
-        std::string multiplierText = "Cash Multiplier: x" + multiplierStream.str();
-        SDL_Surface* multiplierSurface = TTF_RenderText_Blended(font, multiplierText.c_str(), textColor);
-        SDL_Texture* multiplierTexture = SDL_CreateTextureFromSurface(renderer, multiplierSurface);
-        SDL_Rect multiplierRect = {textX, baseY + yOffset, multiplierSurface->w, multiplierSurface->h};
-        SDL_RenderCopy(renderer, multiplierTexture, NULL, &multiplierRect);
-        SDL_FreeSurface(multiplierSurface);
-        SDL_DestroyTexture(multiplierTexture);
+        commands.text(font, textFontSize, arena.format("Cash Multiplier: x%.2f", playerData.getCashMultiplier()),
+            {textX, baseY + yOffset, 0, 0}, textColor);
         yOffset += lineSpacing;
     }
 
     // Total fish caught
-    std::string fishText = "Total Fish Caught: " + std::to_string(playerData.getTotalFishCaught());
-    SDL_Surface* fishSurface = TTF_RenderText_Blended(font, fishText.c_str(), textColor);
-    SDL_Texture* fishTexture = SDL_CreateTextureFromSurface(renderer, fishSurface);
-    SDL_Rect fishRect = {textX, baseY + yOffset, fishSurface->w, fishSurface->h};
-    SDL_RenderCopy(renderer, fishTexture, NULL, &fishRect);
-    SDL_FreeSurface(fishSurface);
-    SDL_DestroyTexture(fishTexture);
-
-    // Reset font size back to default
-    int defaultFontSize = Scale::scaleFontSize(Visuals::FONT_SIZE);
-    TTF_SetFontSize(font, defaultFontSize);
+    commands.text(font, textFontSize, arena.format("Total Fish Caught: %d", playerData.getTotalFishCaught()),
+        {textX, baseY + yOffset, 0, 0}, textColor);
 }
 
-void StoreView::render() {
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderClear(renderer);
+void StoreView::render(RenderCommandBuffer& commands) {
+    commands.clear({0, 0, 0, 255});
 
     // Use animated background instead of static
-    textureManager.drawAnimatedTexture(
-        Resource::BG_STORE_ID, 
-        Resource::BG_STORE_ANIM1_ID, 
-        Resource::BG_STORE_ANIM2_ID, 
-        0, 0, Dimens::SCREEN_W, Dimens::SCREEN_H,
-        Game::BACKGROUND_ANIMATION_DELAY
-    );
+    textureManager.drawAnimatedTexture(commands, backgroundAnimation, 0, 0, Dimens::SCREEN_W, Dimens::SCREEN_H);
     
-    renderStore();
+    renderStore(commands);
 }
 
 std::string StoreView::getRodHoverText() const {
@@ -1,7 +1,9 @@
 #include "text_box.hpp"
 #include <stdexcept>
+#include <algorithm> // For hover wrap width clamp
+#include "frame_arena.hpp" // For hover line splits
 
-void TextBox::renderBox(SDL_Renderer* renderer, const SDL_Color& color) {
+void TextBox::renderBox(RenderCommandBuffer& commands, const SDL_Color& color) {
     if (!font || !hoverFont) {
         throw std::runtime_error("TextBox fonts not set before rendering");
     }
@@ -12,39 +14,28 @@ void TextBox::renderBox(SDL_Renderer* renderer, const SDL_Color& color) {
     SDL_Rect rect = {x, y, width, height};
 
     // Background color - tan
+    SDL_Color background;
     if (hovered) {
         // Lighter tan for hover
-        SDL_SetRenderDrawColor(renderer, Colors::TanHover::R, Colors::TanHover::G, Colors::TanHover::B, Colors::TanHover::A);
+        background = {Colors::TanHover::R, Colors::TanHover::G, Colors::TanHover::B, Colors::TanHover::A};
     } else {
         // Base tan color
-        SDL_SetRenderDrawColor(renderer, Colors::Tan::R, Colors::Tan::G, Colors::Tan::B, Colors::Tan::A);
+        background = {Colors::Tan::R, Colors::Tan::G, Colors::Tan::B, Colors::Tan::A};
     }
 
     // Fill rectangle with the background color
-    SDL_RenderFillRect(renderer, &rect);
+    commands.fillRect(rect, background);
 
     // Outer border - darker brown
-    SDL_SetRenderDrawColor(renderer, Colors::Brown::R, Colors::Brown::G, Colors::Brown::B, Colors::Brown::A);
-    SDL_RenderDrawRect(renderer, &rect);
+    commands.outlineRect(rect, {Colors::Brown::R, Colors::Brown::G, Colors::Brown::B, Colors::Brown::A});
 
     // Inner border - lighter highlight
     SDL_Rect innerRect = {x + 2, y + 2, width - 4, height - 4};
-    SDL_SetRenderDrawColor(renderer, Colors::Wheat::R, Colors::Wheat::G, Colors::Wheat::B, Colors::Wheat::A);
-    SDL_RenderDrawRect(renderer, &innerRect);
+    commands.outlineRect(innerRect, {Colors::Wheat::R, Colors::Wheat::G, Colors::Wheat::B, Colors::Wheat::A});
 
-    // Brown text
+    // Brown text, centered once the replay knows its size
     SDL_Color textColor = {70, 35, 0, 255};
-
-    // Get text dimensions for proper centering
-    int textWidth, textHeight;
-    TTF_SizeText(font, text.c_str(), &textWidth, &textHeight);
-    
-    // Calculate centered position
-    int textX = x + (width - textWidth) / 2;
-    int textY = y + (height - textHeight) / 2;
-    
-    // Render with high quality text
-    writeTextBlended(renderer, text, textX, textY, textColor);
+    commands.text(font, fontSize, text, rect, textColor, TextAlign::CENTER);
 
     if (hovered && showHoverBox) {
         int hoverX = x + width + 10;
@@ -52,28 +43,27 @@ void TextBox::renderBox(SDL_Renderer* renderer, const SDL_Color& color) {
 
         // Background for hover box - semi-transparent tan
         SDL_Rect hoverRect = {hoverX, hoverY, hoverBoxWidth, hoverBoxHeight};
-        SDL_SetRenderDrawColor(renderer, 210, 180, 140, 220); // Tan with transparency
-        SDL_RenderFillRect(renderer, &hoverRect);
+        commands.fillRect(hoverRect, {210, 180, 140, 220}); // Tan with transparency
         
         // Hover box border - darker brown
-        SDL_SetRenderDrawColor(renderer, 139, 69, 19, 255); // Medium brown
-        SDL_RenderDrawRect(renderer, &hoverRect);
+        commands.outlineRect(hoverRect, {139, 69, 19, 255}); // Medium brown
         
         // Render hover text with smaller font and scale
         int lineHeight = Visuals::HOVER_FONT_SIZE + 2;
         lineHeight = int(lineHeight * Scale::getHeightScaleFactor());
         
         // Calculate max chars per line based on hover box width
-        int maxCharsPerLine = hoverBoxWidth / (TTF_FontHeight(hoverFont) / 2);
-        std::string textRemaining = hoverText;
+        int maxCharsPerLine = hoverBoxWidth / std::max(1, hoverFontSize / 2);
+        // Lines are split into the frame arena; the box is drawn every frame while hovered
+        ArenaString textRemaining(hoverText.c_str(), hoverText.length());
         int currentLine = 0;
         
         while (!textRemaining.empty() && currentLine < 3) {
-            std::string lineText;
+            ArenaString lineText;
             
             if (textRemaining.length() <= maxCharsPerLine) {
                 lineText = textRemaining;
-                textRemaining = "";
+                textRemaining.clear();
             } else {
                 // Find space to break the line
                 int breakPos = maxCharsPerLine;
@@ -92,76 +82,9 @@ void TextBox::renderBox(SDL_Renderer* renderer, const SDL_Color& color) {
             
             // Brown hover text
             SDL_Color hoverTextColor = {70, 35, 0, 255};
-            writeHoverTextBlended(renderer, lineText, hoverX + 5, hoverY + 5 + (currentLine * lineHeight), hoverTextColor);
+            SDL_Rect lineArea = {hoverX + 5, hoverY + 5 + (currentLine * lineHeight), hoverBoxWidth - 10, lineHeight};
+            commands.text(hoverFont, hoverFontSize, lineText.c_str(), lineArea, hoverTextColor);
             currentLine++;
         }
     }
 }
-
-// High-quality text rendering
-void TextBox::writeTextBlended(SDL_Renderer* renderer, const std::string& text, int x, int y, const SDL_Color& color) {
-    if (x < 0 || y < 0 || x >= Dimens::SCREEN_W || y >= Dimens::SCREEN_H) {
-        throw std::out_of_range("Text out of bounds");
-        return;
-    }
-
-    // Create surface with font using blended mode for high quality
-    SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), color);
-    if (!surface) {
-        throw std::runtime_error("Failed to create text surface.");
-        return;
-    }
-
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
-
-    if (!texture) {
-        throw std::runtime_error("Failed to create texture from text surface.");
-        return;
-    }
-
-    int text_width, text_height;
-    SDL_QueryTexture(texture, nullptr, nullptr, &text_width, &text_height);
-    SDL_Rect location = {x, y, text_width, text_height};
-    SDL_RenderCopy(renderer, texture, nullptr, &location);
-    SDL_DestroyTexture(texture);
-}
-
-// Keep old method for compatibility
-void TextBox::writeText(SDL_Renderer* renderer, const std::string& text, int x, int y, const SDL_Color& color) {
-    writeTextBlended(renderer, text, x, y, color);
-}
-
-// New high-quality hover text rendering
-void TextBox::writeHoverTextBlended(SDL_Renderer* renderer, const std::string& text, int x, int y, const SDL_Color& color) {
-    if (x < 0 || y < 0 || x >= Dimens::SCREEN_W || y >= Dimens::SCREEN_H) {
-        throw std::out_of_range("Text out of bounds");
-        return;
-    }
-
-    // Create surface with hover font using blended mode for high quality
-    SDL_Surface* surface = TTF_RenderText_Blended(hoverFont, text.c_str(), color);
-    if (!surface) {
-        throw std::runtime_error("Failed to create hover text surface.");
-        return;
-    }
-
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
-
-    if (!texture) {
-        throw std::runtime_error("Failed to create texture from hover text surface.");
-        return;
-    }
-
-    int text_width, text_height;
-    SDL_QueryTexture(texture, nullptr, nullptr, &text_width, &text_height);
-    SDL_Rect location = {x, y, text_width, text_height};
-    SDL_RenderCopy(renderer, texture, nullptr, &location);
-    SDL_DestroyTexture(texture);
-}
-
-// Keep old method just in case
-void TextBox::writeHoverText(SDL_Renderer* renderer, const std::string& text, int x, int y, const SDL_Color& color) {
-    writeHoverTextBlended(renderer, text, x, y, color);
-}
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "texture_manager.hpp"
+#include "render_thread.hpp" // Texture creation/destruction belongs to the renderer thread
+#include "job_system.hpp" // For parallel image decoding
 
 TextureManager::TextureManager(SDL_Renderer* renderer) : renderer(renderer) {
     int imgFlags = IMG_INIT_PNG;
@@ -18,115 +20,179 @@ bool TextureManager::loadTexture(const std::string& id, const std::string& fileP
         std::cerr << "Failed to load image " << filePath << "! SDL_image Error: " << IMG_GetError() << std::endl;
         return false;
     }
+    return addTexture(id, filePath, tempSurface);
+}
+
+/**
+ * @brief Loads a batch of textures, decoding the images in parallel on the job system
+ * @details Decoding is the slow part and touches no renderer state, so it runs on the pool;
+ * textures are then created one at a time on the renderer's thread as loadTexture does.
+ * @param files Names and paths to load
+ * @return bool true if every texture loaded
+ */
+bool TextureManager::loadTextures(const std::vector<TextureFile>& files) {
+    std::vector<SDL_Surface*> surfaces(files.size(), nullptr);
+    JobSystem::shared().parallelFor(static_cast<int>(files.size()), 1, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            surfaces[i] = IMG_Load(files[i].filePath.c_str());
+            if (!surfaces[i]) {
+                // SDL errors are per thread, so report it from the thread that failed
+                std::cerr << "Failed to load image " << files[i].filePath << "! SDL_image Error: " << IMG_GetError() << std::endl;
+            }
+        }
+    });
+
+    bool success = true;
+    for (size_t i = 0; i < files.size(); i++) {
+        success &= surfaces[i] && addTexture(files[i].id, files[i].filePath, surfaces[i]);
+    }
+    return success;
+}
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, tempSurface);
-    SDL_FreeSurface(tempSurface);
+/**
+ * @brief Turns a decoded image into a texture under a name, replacing any texture of that name
+ * @param id Name to store it under
+ * @param filePath Path it came from, for messages
+ * @param surface Decoded image; freed here
+ * @return bool true if the texture was created
+ */
+bool TextureManager::addTexture(const std::string& id, const std::string& filePath, SDL_Surface* surface) {
+    SDL_Texture* texture = nullptr;
+    RenderThread::runOnRenderer([&] { texture = SDL_CreateTextureFromSurface(renderer, surface); });
+    SDL_FreeSurface(surface);
 
     if (!texture) {
         std::cerr << "Failed to create texture from " << filePath << "! SDL Error: " << SDL_GetError() << std::endl;
         return false;
     }
 
-    textureMap[id] = texture;
+    // Reloading a name keeps its id, so ids handed out earlier stay valid
+    auto it = spriteIds.find(id);
+    if (it != spriteIds.end()) {
+        SDL_Texture* old = textures[it->second];
+        RenderThread::runOnRenderer([old] { SDL_DestroyTexture(old); });
+        textures[it->second] = texture;
+    } else {
+        spriteIds[id] = static_cast<SpriteId>(textures.size());
+        textures.push_back(texture);
+    }
     return true;
 }
 
-void TextureManager::drawTexture(const std::string& id, int x, int y, int scaledW, int scaledH, SDL_RendererFlip flip) {
-    auto it = textureMap.find(id);
-    if (it == textureMap.end()) {
+/**
+ * @brief Resolves a texture name to the id draws use; call once at load time, not per frame
+ * @param id Name the texture was loaded under
+ * @return SpriteId index of the texture, NO_SPRITE if it was never loaded
+ */
+SpriteId TextureManager::getSpriteId(const std::string& id) const {
+    auto it = spriteIds.find(id);
+    if (it == spriteIds.end()) {
         std::cerr << "Texture with ID " << id << " not found!" << std::endl;
-        return;
+        return NO_SPRITE;
     }
+    return it->second;
+}
 
-    int spriteH, spriteW;
-    SDL_QueryTexture(it->second, nullptr, nullptr, &spriteW, &spriteH);
-    
-    SDL_Rect srcRect = {0, 0, spriteW, spriteH}; // Origin image
-    SDL_Rect destRect = {x, y, scaledW, scaledH}; // Scaled image
-
-    SDL_RenderCopyEx(renderer, it->second, &srcRect, &destRect, 0, nullptr, flip);
+/**
+ * @brief Registers a two-frame animation between loaded textures
+ * @param frame1Id Name of the first frame
+ * @param frame2Id Name of the second frame
+ * @param delay Milliseconds each frame is shown
+ * @return AnimationId id to draw it with
+ */
+AnimationId TextureManager::addAnimation(const std::string& frame1Id, const std::string& frame2Id, int delay) {
+    animations.push_back({getSpriteId(frame1Id), getSpriteId(frame2Id), delay, 0, false, true});
+    return static_cast<AnimationId>(animations.size() - 1);
 }
 
-void TextureManager::drawRotatedTexture(const std::string& id, int x, int y, int scaledW, int scaledH, 
-    double angle, SDL_RendererFlip flip) {
-    auto it = textureMap.find(id);
-    if (it == textureMap.end()) {
+/**
+ * @brief Array lookup of a texture by id
+ * @return SDL_Texture* texture, nullptr (with a message) for an unknown id
+ */
+SDL_Texture* TextureManager::textureFor(SpriteId id) const {
+    if (id < 0 || id >= static_cast<SpriteId>(textures.size())) {
         std::cerr << "Texture with ID " << id << " not found!" << std::endl;
+        return nullptr;
+    }
+    return textures[id];
+}
+
+void TextureManager::drawTexture(RenderCommandBuffer& commands, SpriteId id, int x, int y, int scaledW, int scaledH, SDL_RendererFlip flip) {
+    SDL_Texture* texture = textureFor(id);
+    if (!texture) {
         return;
     }
 
-    int spriteH, spriteW;
-    SDL_QueryTexture(it->second, nullptr, nullptr, &spriteW, &spriteH);
+    SDL_Rect destRect = {x, y, scaledW, scaledH}; // Scaled image, whole texture as source
+    commands.sprite(texture, destRect, flip);
+}
 
-    SDL_Rect srcRect = {0, 0, spriteW, spriteH}; // Origin image
-    SDL_Rect destRect = {x, y, scaledW, scaledH}; // Scaled image
+void TextureManager::drawRotatedTexture(RenderCommandBuffer& commands, SpriteId id, int x, int y, int scaledW, int scaledH, 
+    double angle, SDL_RendererFlip flip) {
+    SDL_Texture* texture = textureFor(id);
+    if (!texture) {
+        return;
+    }
 
-    // Calculate center point for rotation
-    SDL_Point center = {scaledW / 2, scaledH / 2};
+    SDL_Rect destRect = {x, y, scaledW, scaledH}; // Scaled image, rotated about its center
 
-    SDL_RenderCopyEx(renderer, it->second, &srcRect, &destRect, angle, &center, flip);
+    commands.rotatedSprite(texture, destRect, angle, flip);
 }
 
-std::string TextureManager::getCurrentAnimationFrame(const std::string& baseId, 
-    const std::string& anim1Id, const std::string& anim2Id, int delay) {
-    
-    // Check if this is a caught fish (use static texture) - this case will be handled in the fishing_view.cpp
-    if (baseId.find("fish") != std::string::npos) {
+SpriteId TextureManager::getCurrentAnimationFrame(AnimationId animation) {
+    if (animation < 0 || animation >= static_cast<AnimationId>(animations.size())) {
+        std::cerr << "Animation with ID " << animation << " not found!" << std::endl;
+        return NO_SPRITE;
     }
+    Animation& state = animations[animation];
     
     // Get current time
     Uint32 currentTime = SDL_GetTicks();
     
-    // Initialize animation state if not yet tracked
-    if (lastAnimationTime.find(baseId) == lastAnimationTime.end()) {
-        lastAnimationTime[baseId] = currentTime;
-        animationFrameState[baseId] = true; // Start with first frame
+    // Initialize animation state on first draw
+    if (!state.started) {
+        state.started = true;
+        state.lastSwitch = currentTime;
+        state.onFrame1 = true; // Start with first frame
     }
     
     // Check if it's time to change animation frame
-    if (currentTime - lastAnimationTime[baseId] > delay) {
+    if (currentTime - state.lastSwitch > static_cast<Uint32>(state.delay)) {
         // Toggle animation state
-        animationFrameState[baseId] = !animationFrameState[baseId];
+        state.onFrame1 = !state.onFrame1;
         // Update last animation time
-        lastAnimationTime[baseId] = currentTime;
+        state.lastSwitch = currentTime;
     }
     
-    // Return the appropriate frame ID based on current state
-    return animationFrameState[baseId] ? anim1Id : anim2Id;
+    // Return the appropriate frame based on current state
+    return state.onFrame1 ? state.frame1 : state.frame2;
 }
 
-void TextureManager::drawAnimatedTexture(const std::string& baseId, const std::string& anim1Id, 
-    const std::string& anim2Id, int x, int y, int scaledW, int scaledH, 
-    int delay, SDL_RendererFlip flip) {
-    
-    // Get current animation frame ID
-    std::string currentFrameId = getCurrentAnimationFrame(baseId, anim1Id, anim2Id, delay);
+void TextureManager::drawAnimatedTexture(RenderCommandBuffer& commands, AnimationId animation, int x, int y, int scaledW, int scaledH,
+    SDL_RendererFlip flip) {
     
     // Draw the current animation frame
-    drawTexture(currentFrameId, x, y, scaledW, scaledH, flip);
+    drawTexture(commands, getCurrentAnimationFrame(animation), x, y, scaledW, scaledH, flip);
 }
 
-void TextureManager::drawAnimatedRotatedTexture(const std::string& baseId, const std::string& anim1Id, 
-    const std::string& anim2Id, int x, int y, int scaledW, int scaledH, 
-    double angle, int delay, SDL_RendererFlip flip) {
-    
-    // Get current animation frame ID
-    std::string currentFrameId = getCurrentAnimationFrame(baseId, anim1Id, anim2Id, delay);
+void TextureManager::drawAnimatedRotatedTexture(RenderCommandBuffer& commands, AnimationId animation, int x, int y, int scaledW, int scaledH,
+    double angle, SDL_RendererFlip flip) {
     
     // Draw the current animation frame with rotation
-    drawRotatedTexture(currentFrameId, x, y, scaledW, scaledH, angle, flip);
+    drawRotatedTexture(commands, getCurrentAnimationFrame(animation), x, y, scaledW, scaledH, angle, flip);
 }
 
 void TextureManager::clearTextures() {
-    for (auto& pair : textureMap) {
-        SDL_DestroyTexture(pair.second);
-    }
-    textureMap.clear();
+    RenderThread::runOnRenderer([this] {
+        for (SDL_Texture* texture : textures) {
+            SDL_DestroyTexture(texture);
+        }
+    });
+    textures.clear();
+    spriteIds.clear();
     
-    // Clear animation tracking maps too
-    animationFrameState.clear();
-    lastAnimationTime.clear();
-    animationDelays.clear();
+    // Animations point at the textures, drop them too
+    animations.clear();
 }
 
 // Used in BaseView but may be dead code
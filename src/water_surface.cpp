@@ -0,0 +1,111 @@
+#include <algorithm> // For clamps and buffer swaps
+
+#include "water_surface.hpp" // Class header
+#include "game_constants.hpp" // For wave settings
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h> // For the 4-wide wave kernel
+#define WATER_SURFACE_SSE
+#endif
+
+namespace
+{
+    uint32_t argb(int r, int g, int b, int a)
+    {
+        return static_cast<uint32_t>(a) << 24 | static_cast<uint32_t>(r) << 16 | static_cast<uint32_t>(g) << 8 | static_cast<uint32_t>(b);
+    }
+}
+
+/**
+ * @brief Sizes the height field and pixel strip; the water starts flat
+ * @param columns Simulated columns across the pond, also the texture width
+ * @param rows Texture height
+ * @param world Round metrics, for the waterline and pond width
+ */
+WaterSurface::WaterSurface(int columns, int rows, const WorldMetrics& world) :
+    columns(std::max(1, columns)),
+    rows(std::max(2, rows)),
+    worldW(world.screenW),
+    surfaceY(world.surfaceY),
+    band(world.scaleH(Visuals::WATER_BAND_PERCENT))
+{
+    // Whole registers past the last column, so the kernel needs no scalar tail
+    size_t padded = (this->columns + LANES - 1) / LANES * LANES + 2;
+    heights.assign(padded, 0.0f);
+    previous.assign(padded, 0.0f);
+    pixels.assign(static_cast<size_t>(this->columns) * this->rows, 0);
+}
+
+/**
+ * @brief Pushes the water down (or up, when negative) around a point
+ * @param worldX Where, world space
+ * @param strength Depth of the dent in world units
+ */
+void WaterSurface::disturb(float worldX, float strength)
+{
+    int center = static_cast<int>(worldX / worldW * columns) + 1;
+    for (int offset = -2; offset <= 2; offset++) {
+        int column = center + offset;
+        if (column >= 1 && column <= columns) {
+            heights[column] += strength / (1 + offset * offset);
+        }
+    }
+}
+
+/**
+ * @brief Advances the ripples one tick
+ */
+void WaterSurface::step()
+{
+    const float speed = Visuals::WATER_WAVE_SPEED;
+    const float damping = Visuals::WATER_DAMPING;
+    float* next = previous.data(); // Overwritten in place: each column's old height is read only by itself
+    const float* now = heights.data();
+#ifdef WATER_SURFACE_SSE
+    const __m128 k = _mm_set1_ps(speed);
+    const __m128 keep = _mm_set1_ps(damping);
+    const __m128 two = _mm_set1_ps(2.0f);
+    for (int c = 1; c <= columns; c += LANES) {
+        __m128 center = _mm_loadu_ps(now + c);
+        __m128 sides = _mm_add_ps(_mm_loadu_ps(now + c - 1), _mm_loadu_ps(now + c + 1));
+        __m128 curvature = _mm_sub_ps(sides, _mm_mul_ps(two, center));
+        __m128 moved = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(two, center), _mm_mul_ps(k, curvature)), _mm_loadu_ps(next + c));
+        _mm_storeu_ps(next + c, _mm_mul_ps(moved, keep));
+    }
+#else
+    for (int c = 1; c <= columns; c++) {
+        float curvature = now[c - 1] + now[c + 1] - 2.0f * now[c];
+        next[c] = (2.0f * now[c] + speed * curvature - next[c]) * damping;
+    }
+#endif
+    // The padding past the last column was written too; keep it flat
+    std::fill(previous.begin() + columns + 1, previous.end(), 0.0f);
+    heights.swap(previous);
+}
+
+/**
+ * @brief Redraws the pixel strip from the current heights
+ */
+void WaterSurface::rasterize()
+{
+    const uint32_t clear = 0;
+    const uint32_t foam = argb(235, 245, 255, 220);
+    const float rowHeight = 2 * band / rows;
+    for (int c = 0; c < columns; c++) {
+        // Row the wave's top crosses, counted from the strip's top
+        float height = std::min(std::max(heights[c + 1], -band), band);
+        float waveRow = (height + band) / rowHeight;
+        int firstWater = static_cast<int>(waveRow);
+        uint32_t* pixel = pixels.data() + c;
+        for (int r = 0; r < rows; r++, pixel += columns) {
+            if (r < firstWater) {
+                *pixel = clear;
+            } else if (r < firstWater + 2) {
+                *pixel = foam;
+            } else {
+                int alpha = 160 * (rows - r) / rows; // Fades into the background's own water
+                *pixel = argb(40, 110, 190, alpha);
+            }
+        }
+    }
+}
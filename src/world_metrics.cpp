@@ -0,0 +1,65 @@
+#include "world_metrics.hpp" // Class header
+#include "game_constants.hpp" // For percentages and base speeds
+
+/**
+ * @brief Computes all scaled sizes and limits for a screen size
+ * @param width Screen width in pixels
+ * @param height Screen height in pixels
+ * @return WorldMetrics metrics for that resolution
+ */
+WorldMetrics WorldMetrics::fromScreen(float width, float height)
+{
+    WorldMetrics m;
+    m.screenW = width;
+    m.screenH = height;
+    m.centerX = width / 2;
+    m.centerY = height / 2;
+    m.widthScale = width / Dimens::WORLD_W; // Reference resolution, matches Scale::
+    m.heightScale = height / Dimens::WORLD_H;
+
+    m.surfaceY = m.scaleH(Visuals::SURFACE_POND_PERCENT);
+    m.rodMinY = m.scaleH(Game::ROD_MIN_LENGTH_PERCENT);
+    m.rodMaxY = m.scaleH(Game::ROD_MAX_LENGTH_PERCENT);
+    m.rodRadiusX = m.scaleW(Game::ROD_RADIUSX_PERCENT);
+    m.rodRadiusY = m.scaleH(Game::ROD_RADIUSY_PERCENT);
+    m.rodHitRadiusX = m.rodRadiusX * 1.2f;
+    m.rodHitRadiusY = m.rodRadiusY * 1.2f;
+    m.rodSpeed = Game::ROD_SPEED * m.heightScale;
+
+    m.fishW = m.scaleW(Visuals::FISH_WIDTH_PERCENT);
+    m.fishH = m.scaleH(Visuals::FISH_HEIGHT_PERCENT);
+    m.fishSpeed = Game::MAX_FISH_SPEED * m.widthScale;
+    m.mediumFishW = m.scaleW(Visuals::MEDIUM_FISH_WIDTH_PERCENT);
+    m.mediumFishH = m.scaleH(Visuals::MEDIUM_FISH_HEIGHT_PERCENT);
+    m.mediumFishSpeed = Game::MAX_MEDIUM_FISH_SPEED * m.widthScale;
+    m.bigFishW = m.scaleW(Visuals::BIG_FISH_WIDTH_PERCENT);
+    m.bigFishH = m.scaleH(Visuals::BIG_FISH_HEIGHT_PERCENT);
+    m.bigFishSpeed = Game::MAX_BIG_FISH_SPEED * m.widthScale;
+
+    m.hazardW = m.scaleW(Visuals::HAZARD_WIDTH_PERCENT);
+    m.hazardH = m.scaleH(Visuals::HAZARD_HEIGHT_PERCENT);
+    m.heavyHazardW = m.scaleW(Visuals::HEAVY_HAZARD_WIDTH_PERCENT);
+    m.heavyHazardH = m.scaleH(Visuals::HEAVY_HAZARD_HEIGHT_PERCENT);
+    m.shockHazardW = m.scaleW(Visuals::SHOCK_HAZARD_WIDTH_PERCENT);
+    m.shockHazardH = m.scaleH(Visuals::SHOCK_HAZARD_HEIGHT_PERCENT);
+    m.hazardSpeed = Game::MAX_HAZARD_SPEED * m.widthScale;
+    return m;
+}
+
+/**
+ * @brief Metrics for the current window size
+ * @return WorldMetrics built from Dimens::SCREEN_W/H
+ */
+WorldMetrics WorldMetrics::fromCurrentScreen()
+{
+    return fromScreen(Dimens::SCREEN_W, Dimens::SCREEN_H);
+}
+
+/**
+ * @brief Metrics for the fixed simulation space
+ * @return WorldMetrics with a scale factor of 1
+ */
+WorldMetrics WorldMetrics::world()
+{
+    return fromScreen(Dimens::WORLD_W, Dimens::WORLD_H);
+}